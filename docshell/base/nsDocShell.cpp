@@ -15005,6 +15005,13 @@ nsDocShell::ShouldPrepareForIntercept(nsIURI* aURI, bool aIsNonSubresourceReques
     return rv.StealNSResult();
   }
 
+  // If the controlling worker has no fetch event handler, the interception
+  // would only be reset to the network, so skip setting up and tearing down
+  // the intercepted channel for every subresource load.
+  if (*aShouldIntercept) {
+    *aShouldIntercept = swm->ControllerHandlesFetch(doc);
+  }
+
   return NS_OK;
 }
 
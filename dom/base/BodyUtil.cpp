@@ -495,6 +495,22 @@ BodyUtil::ConsumeText(uint32_t aInputLength, uint8_t* aInput,
   return NS_OK;
 }
 
+static void
+ThrowJsonParseError(JSContext* aCx, ErrorResult& aRv)
+{
+  if (!JS_IsExceptionPending(aCx)) {
+    aRv.Throw(NS_ERROR_DOM_UNKNOWN_ERR);
+    return;
+  }
+
+  JS::Rooted<JS::Value> exn(aCx);
+  DebugOnly<bool> gotException = JS_GetPendingException(aCx, &exn);
+  MOZ_ASSERT(gotException);
+
+  JS_ClearPendingException(aCx);
+  aRv.ThrowJSException(aCx, exn);
+}
+
 // static
 void
 BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
@@ -504,17 +520,24 @@ BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
 
   JS::Rooted<JS::Value> json(aCx);
   if (!JS_ParseJSON(aCx, aStr.get(), aStr.Length(), &json)) {
-    if (!JS_IsExceptionPending(aCx)) {
-      aRv.Throw(NS_ERROR_DOM_UNKNOWN_ERR);
-      return;
-    }
+    ThrowJsonParseError(aCx, aRv);
+    return;
+  }
 
-    JS::Rooted<JS::Value> exn(aCx);
-    DebugOnly<bool> gotException = JS_GetPendingException(aCx, &exn);
-    MOZ_ASSERT(gotException);
+  aValue.set(json);
+}
 
-    JS_ClearPendingException(aCx);
-    aRv.ThrowJSException(aCx, exn);
+// static
+void
+BodyUtil::ConsumeAsciiJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                           uint32_t aInputLength, const uint8_t* aInput,
+                           ErrorResult& aRv)
+{
+  aRv.MightThrowJSException();
+
+  JS::Rooted<JS::Value> json(aCx);
+  if (!JS_ParseJSON(aCx, aInput, aInputLength, &json)) {
+    ThrowJsonParseError(aCx, aRv);
     return;
   }
 
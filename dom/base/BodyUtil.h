@@ -60,6 +60,16 @@ public:
   static void
   ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
               const nsString& aStr, ErrorResult& aRv);
+
+  /**
+   * Like ConsumeJson, but parses |aInput| in place. The caller must ensure
+   * that |aInput| is ASCII, so that it is its own UTF-8 decoding. This avoids
+   * widening large JSON bodies to UTF-16 before parsing them.
+   */
+  static void
+  ConsumeAsciiJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                   uint32_t aInputLength, const uint8_t* aInput,
+                   ErrorResult& aRv);
 };
 
 } // namespace dom
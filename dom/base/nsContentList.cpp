@@ -717,6 +717,14 @@ nsContentList::AttributeChanged(nsIDocument *aDocument, Element* aElement,
     return;
   }
 
+  if (nsContentUtils::IsClassNamesMatchFunc(mFunc) &&
+      (aNameSpaceID != kNameSpaceID_None ||
+       aAttribute != nsGkAtoms::_class)) {
+    // getElementsByClassName lists only care about the class attribute. Skip
+    // the match and the linear search of mElements for everything else.
+    return;
+  }
+
   if (Match(aElement)) {
     if (mElements.IndexOf(aElement) == mElements.NoIndex) {
       // We match aElement now, and it's not in our list already.  Just dirty
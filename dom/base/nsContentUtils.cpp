@@ -9393,76 +9393,80 @@ private:
     aFirst->mLast = this;
   }
 
+  // The encoders below copy runs of characters that need no escaping in one
+  // go instead of appending one character at a time.
+
   void EncodeAttrString(const nsAutoString& aValue, nsAString& aOut)
   {
     const char16_t* c = aValue.BeginReading();
     const char16_t* end = aValue.EndReading();
+    const char16_t* runStart = c;
     while (c < end) {
+      const char* entity;
       switch (*c) {
       case '"':
-        aOut.AppendLiteral("&quot;");
+        entity = "&quot;";
         break;
       case '&':
-        aOut.AppendLiteral("&amp;");
+        entity = "&amp;";
         break;
       case 0x00A0:
-        aOut.AppendLiteral("&nbsp;");
+        entity = "&nbsp;";
         break;
       default:
-        aOut.Append(*c);
-        break;
+        ++c;
+        continue;
       }
-      ++c;
+      aOut.Append(runStart, c - runStart);
+      aOut.AppendASCII(entity);
+      runStart = ++c;
     }
+    aOut.Append(runStart, end - runStart);
   }
 
-  void EncodeTextFragment(const nsTextFragment* aValue, nsAString& aOut)
+  template<typename CharT>
+  static const char* TextEntityFor(CharT aChar)
+  {
+    switch (aChar) {
+      case '<':
+        return "&lt;";
+      case '>':
+        return "&gt;";
+      case '&':
+        return "&amp;";
+      case 0x00A0:
+        return "&nbsp;";
+      default:
+        return nullptr;
+    }
+  }
+
+  template<typename CharT>
+  static void EncodeTextRuns(const nsTextFragment* aValue, const CharT* aData,
+                             nsAString& aOut)
   {
     uint32_t len = aValue->GetLength();
-    if (aValue->Is2b()) {
-      const char16_t* data = aValue->Get2b();
-      for (uint32_t i = 0; i < len; ++i) {
-        const char16_t c = data[i];
-        switch (c) {
-          case '<':
-            aOut.AppendLiteral("&lt;");
-            break;
-          case '>':
-            aOut.AppendLiteral("&gt;");
-            break;
-          case '&':
-            aOut.AppendLiteral("&amp;");
-            break;
-          case 0x00A0:
-            aOut.AppendLiteral("&nbsp;");
-            break;
-          default:
-            aOut.Append(c);
-            break;
-        }
+    uint32_t runStart = 0;
+    for (uint32_t i = 0; i < len; ++i) {
+      const char* entity = TextEntityFor(aData[i]);
+      if (!entity) {
+        continue;
       }
+      aValue->AppendTo(aOut, runStart, i - runStart);
+      aOut.AppendASCII(entity);
+      runStart = i + 1;
+    }
+    aValue->AppendTo(aOut, runStart, len - runStart);
+  }
+
+  void EncodeTextFragment(const nsTextFragment* aValue, nsAString& aOut)
+  {
+    if (aValue->Is2b()) {
+      EncodeTextRuns(aValue, aValue->Get2b(), aOut);
     } else {
-      const char* data = aValue->Get1b();
-      for (uint32_t i = 0; i < len; ++i) {
-        const unsigned char c = data[i];
-        switch (c) {
-          case '<':
-            aOut.AppendLiteral("&lt;");
-            break;
-          case '>':
-            aOut.AppendLiteral("&gt;");
-            break;
-          case '&':
-            aOut.AppendLiteral("&amp;");
-            break;
-          case 0x00A0:
-            aOut.AppendLiteral("&nbsp;");
-            break;
-          default:
-            aOut.Append(c);
-            break;
-        }
-      }
+      EncodeTextRuns(aValue,
+                     reinterpret_cast<const unsigned char*>(aValue->Get1b()),
+                     aOut);
     }
   }
 
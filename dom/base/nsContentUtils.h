@@ -2099,6 +2099,15 @@ public:
                                                                          aClasses);
   }
 
+  /**
+   * Returns true if aFunc is the match function of the lists returned by
+   * GetElementsByClassName, which only depend on the class attribute.
+   */
+  static bool IsClassNamesMatchFunc(nsContentListMatchFunc aFunc)
+  {
+    return aFunc == MatchClassNames;
+  }
+
   /**
    * Returns a presshell for this document, if there is one. This will be
    * aDoc's direct presshell if there is one, otherwise we'll look at all
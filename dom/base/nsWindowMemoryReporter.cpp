@@ -364,6 +364,12 @@ CollectWindowReports(nsGlobalWindow *aWindow,
               "within a window.");
   aWindowTotalSizes->mLayoutPresShellSize += windowSizes.mLayoutPresShellSize;
 
+  REPORT_SIZE("/layout/pres-arena-free", windowSizes.mLayoutPresArenaFreeSize,
+              "Memory held in the PresShell's arena by freed objects that are "
+              "waiting to be recycled, within a window.");
+  aWindowTotalSizes->mLayoutPresArenaFreeSize +=
+    windowSizes.mLayoutPresArenaFreeSize;
+
   REPORT_SIZE("/layout/style-sets", windowSizes.mLayoutStyleSetsSize,
               "Memory used by style sets within a window.");
   aWindowTotalSizes->mLayoutStyleSetsSize += windowSizes.mLayoutStyleSetsSize;
@@ -638,6 +644,10 @@ nsWindowMemoryReporter::CollectReports(nsIHandleReportCallback* aHandleReport,
          windowTotalSizes.mLayoutPresShellSize,
          "This is the sum of all windows' 'layout/arenas' numbers.");
 
+  REPORT("window-objects/layout/pres-arena-free",
+         windowTotalSizes.mLayoutPresArenaFreeSize,
+         "This is the sum of all windows' 'layout/pres-arena-free' numbers.");
+
   REPORT("window-objects/layout/style-sets",
          windowTotalSizes.mLayoutStyleSetsSize,
          "This is the sum of all windows' 'layout/style-sets' numbers.");
@@ -9,6 +9,7 @@
 
 #include "nsIInputStreamPump.h"
 #include "nsProxyRelease.h"
+#include "nsReadableUtils.h"
 #include "WorkerPrivate.h"
 #include "WorkerRunnable.h"
 #include "WorkerScope.h"
@@ -617,6 +618,19 @@ FetchBodyConsumer<Derived>::ContinueConsumeBody(nsresult aStatus,
     case CONSUME_TEXT:
       // fall through handles early exit.
     case CONSUME_JSON: {
+      // JSON bodies are very often pure ASCII; parse those directly instead
+      // of decoding them to UTF-16 first.
+      if (mConsumeType == CONSUME_JSON &&
+          IsASCII(nsDependentCSubstring(reinterpret_cast<char*>(aResult),
+                                        aResultLength))) {
+        JS::Rooted<JS::Value> json(cx);
+        BodyUtil::ConsumeAsciiJson(cx, &json, aResultLength, aResult, error);
+        if (!error.Failed()) {
+          localPromise->MaybeResolve(cx, json);
+        }
+        break;
+      }
+
       nsString decoded;
       if (NS_SUCCEEDED(BodyUtil::ConsumeText(aResultLength, aResult, decoded))) {
         if (mConsumeType == CONSUME_TEXT) {
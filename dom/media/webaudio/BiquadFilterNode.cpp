@@ -205,7 +205,13 @@ public:
           input = alignedInputBuffer;
         }
       }
-      SetParamsOnBiquad(mBiquads[i], aStream->SampleRate(), mType, freq, q, gain, detune);
+      // All channels share the same parameters, so only compute the
+      // coefficients once per block.
+      if (i == 0) {
+        SetParamsOnBiquad(mBiquads[i], aStream->SampleRate(), mType, freq, q, gain, detune);
+      } else {
+        mBiquads[i].copyCoefficientsFrom(mBiquads[0]);
+      }
 
       mBiquads[i].process(input,
                           aOutput->ChannelFloatsForWrite(i),
@@ -66,6 +66,16 @@ public:
     // (The zeroes will be the inverse of the poles)
     void setAllpassPole(const Complex& pole);
 
+    // Copy the coefficients, but not the filter memory, of another biquad.
+    void copyCoefficientsFrom(const Biquad& other)
+    {
+        m_b0 = other.m_b0;
+        m_b1 = other.m_b1;
+        m_b2 = other.m_b2;
+        m_a1 = other.m_a1;
+        m_a2 = other.m_a2;
+    }
+
     // Return true iff the next output block will contain sound even with
     // silent input.
     bool hasTail() const { return m_y1 || m_y2 || m_x1 || m_x2; }
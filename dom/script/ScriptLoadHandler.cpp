@@ -11,6 +11,7 @@
 #include "nsContentUtils.h"
 
 #include "mozilla/Telemetry.h"
+#include "mozilla/Unused.h"
 
 namespace mozilla {
 namespace dom {
@@ -276,6 +277,7 @@ ScriptLoadHandler::EnsureKnownDataType(nsIIncrementalStreamLoader* aLoader)
   if (mRequest->IsLoadingSource()) {
     mRequest->mDataType = ScriptLoadRequest::DataType::Source;
     TRACE_FOR_TEST(mRequest->mElement, "scriptloader_load_source");
+    ReserveBufferForContentLength(aLoader);
     return NS_OK;
   }
 
@@ -302,9 +304,43 @@ ScriptLoadHandler::EnsureKnownDataType(nsIIncrementalStreamLoader* aLoader)
   }
   MOZ_ASSERT(!mRequest->IsUnknownDataType());
   MOZ_ASSERT(mRequest->IsLoading());
+  ReserveBufferForContentLength(aLoader);
   return NS_OK;
 }
 
+void
+ScriptLoadHandler::ReserveBufferForContentLength(nsIIncrementalStreamLoader* aLoader)
+{
+  // Don't trust absurdly large content lengths.
+  static const int64_t kMaxReservedLength = 64 * 1024 * 1024;
+
+  // Slack left at the end of the text buffer, as DecodeRawData also reserves
+  // room for the few extra code units a decoder may flush.
+  static const int64_t kTextBufferSlack = 16;
+
+  nsCOMPtr<nsIRequest> req;
+  aLoader->GetRequest(getter_AddRefs(req));
+  nsCOMPtr<nsIChannel> channel = do_QueryInterface(req);
+  if (!channel) {
+    return;
+  }
+
+  int64_t length = -1;
+  if (NS_FAILED(channel->GetContentLength(&length)) ||
+      length <= 0 || length > kMaxReservedLength) {
+    return;
+  }
+
+  // None of the decoders produce more UTF-16 code units than there are input
+  // bytes. Failing to reserve is fine, as the buffers grow as data arrives.
+  if (mRequest->IsSource()) {
+    Unused << mRequest->mScriptText.reserve(size_t(length + kTextBufferSlack));
+  } else {
+    MOZ_ASSERT(mRequest->IsBytecode());
+    Unused << mRequest->mScriptBytecode.reserve(size_t(length));
+  }
+}
+
 NS_IMETHODIMP
 ScriptLoadHandler::OnStreamComplete(nsIIncrementalStreamLoader* aLoader,
                                     nsISupports* aContext,
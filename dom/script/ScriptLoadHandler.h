@@ -61,6 +61,10 @@ private:
   // Query the channel to find the data type associated with the input stream.
   nsresult EnsureKnownDataType(nsIIncrementalStreamLoader* aLoader);
 
+  // Size the buffer accumulating the script from the channel's content
+  // length, so that large scripts are not copied repeatedly as they arrive.
+  void ReserveBufferForContentLength(nsIIncrementalStreamLoader* aLoader);
+
   // ScriptLoader which will handle the parsed script.
   RefPtr<ScriptLoader> mScriptLoader;
 
@@ -2331,15 +2331,42 @@ ScriptLoader::EncodeBytecode()
     return;
   }
 
-  Telemetry::AutoTimer<Telemetry::DOM_SCRIPT_ENCODING_MS_PER_DOCUMENT> timer;
-  AutoEntryScript aes(globalObject, "encode bytecode", true);
-  RefPtr<ScriptLoadRequest> request;
-  while (!mBytecodeEncodingQueue.isEmpty()) {
-    request = mBytecodeEncodingQueue.StealFirst();
+  if (mBytecodeEncodingQueue.isEmpty()) {
+    return;
+  }
+
+  // Encoding the bytecode of a large script can take a while, so only encode
+  // one script per idle callback instead of blocking the main thread until the
+  // whole queue is saved.
+  TimeStamp start = TimeStamp::Now();
+  {
+    AutoEntryScript aes(globalObject, "encode bytecode", true);
+    RefPtr<ScriptLoadRequest> request = mBytecodeEncodingQueue.StealFirst();
     EncodeRequestBytecode(aes.cx(), request);
     request->mScriptBytecode.clearAndFree();
     request->DropBytecodeCacheReferences();
   }
+  mBytecodeEncodingTime += TimeStamp::Now() - start;
+
+  if (!mBytecodeEncodingQueue.isEmpty()) {
+    MaybeTriggerBytecodeEncoding();
+    return;
+  }
+
+  ReportBytecodeEncodingTime();
+}
+
+void
+ScriptLoader::ReportBytecodeEncodingTime()
+{
+  // Nothing was encoded since the last report, e.g. when giving up again.
+  if (mBytecodeEncodingTime == TimeDuration()) {
+    return;
+  }
+
+  Telemetry::Accumulate(Telemetry::DOM_SCRIPT_ENCODING_MS_PER_DOCUMENT,
+                        uint32_t(mBytecodeEncodingTime.ToMilliseconds()));
+  mBytecodeEncodingTime = TimeDuration();
 }
 
 void
@@ -2411,6 +2438,10 @@ ScriptLoader::GiveUpBytecodeEncoding()
   // to avoid queuing more scripts.
   mGiveUpEncoding = true;
 
+  // Record the time already spent encoding the scripts that were saved before
+  // giving up, as it was still spent on the main thread.
+  ReportBytecodeEncodingTime();
+
   // Ideally we prefer to properly end the incremental encoder, such that we
   // would not keep a large buffer around.  If we cannot, we fallback on the
   // removal of all request from the current list and these large buffers would
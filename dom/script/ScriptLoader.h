@@ -25,6 +25,7 @@
 #include "mozilla/dom/SRICheck.h"
 #include "mozilla/MozPromise.h"
 #include "mozilla/net/ReferrerPolicy.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Vector.h"
 
 class nsIURI;
@@ -436,12 +437,19 @@ private:
   void MaybeTriggerBytecodeEncoding();
 
   /**
-   * Iterate over all script load request and save the bytecode of executed
-   * functions on the cache provided by the channel.
+   * Save the bytecode of executed functions of the next script load request on
+   * the cache provided by the channel, and schedule another idle callback to
+   * encode the remaining ones.
    */
   void EncodeBytecode();
   void EncodeRequestBytecode(JSContext* aCx, ScriptLoadRequest* aRequest);
 
+  /**
+   * Report the time spent encoding bytecode since the last report, once the
+   * queue is saved or encoding is given up.
+   */
+  void ReportBytecodeEncodingTime();
+
   void GiveUpBytecodeEncoding();
 
   already_AddRefed<nsIScriptGlobalObject> GetScriptGlobalObject();
@@ -548,6 +556,10 @@ private:
   bool mLoadEventFired;
   bool mGiveUpEncoding;
 
+  // Time spent encoding the bytecode of this document's scripts so far,
+  // accumulated across the idle callbacks that do the encoding.
+  mozilla::TimeDuration mBytecodeEncodingTime;
+
   // Module map
   nsRefPtrHashtable<nsURIHashKey, mozilla::GenericPromise::Private> mFetchingModules;
   nsRefPtrHashtable<nsURIHashKey, ModuleScript> mFetchedModules;
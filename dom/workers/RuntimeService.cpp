@@ -107,14 +107,19 @@ static_assert(MAX_WORKERS_PER_DOMAIN >= 1,
 // content workers.
 #define MAX_SCRIPT_RUN_TIME_SEC 10
 
-// The number of seconds that idle threads can hang around before being killed.
+// The number of seconds that idle threads can hang around before being killed,
+// overridable via pref.
 #define IDLE_THREAD_TIMEOUT_SEC 30
 
-// The maximum number of threads that can be idle at one time.
+// The maximum number of threads that can be idle at one time, overridable via
+// pref.
 #define MAX_IDLE_THREADS 20
 
 #define PREF_WORKERS_PREFIX "dom.workers."
 #define PREF_WORKERS_MAX_PER_DOMAIN PREF_WORKERS_PREFIX "maxPerDomain"
+#define PREF_WORKERS_MAX_IDLE_THREADS PREF_WORKERS_PREFIX "maxIdleThreads"
+#define PREF_WORKERS_IDLE_THREAD_TIMEOUT PREF_WORKERS_PREFIX "idleThreadTimeoutSec"
+#define PREF_WORKERS_PREWARM_THREADS PREF_WORKERS_PREFIX "prewarmThreads"
 #define PREF_WORKERS_MAX_HARDWARE_CONCURRENCY "dom.maxHardwareConcurrency"
 
 #define PREF_MAX_SCRIPT_RUN_TIME_CONTENT "dom.max_script_run_time"
@@ -156,6 +161,8 @@ const uint32_t kNoIndex = uint32_t(-1);
 
 uint32_t gMaxWorkersPerDomain = MAX_WORKERS_PER_DOMAIN;
 uint32_t gMaxHardwareConcurrency = MAX_HARDWARE_CONCURRENCY;
+uint32_t gMaxIdleThreads = MAX_IDLE_THREADS;
+uint32_t gIdleThreadTimeoutSec = IDLE_THREAD_TIMEOUT_SEC;
 
 // Does not hold an owning reference.
 RuntimeService* gRuntimeService = nullptr;
@@ -2048,6 +2055,35 @@ RuntimeService::Init()
                         MAX_HARDWARE_CONCURRENCY);
   gMaxHardwareConcurrency = std::max(0, maxHardwareConcurrency);
 
+  int32_t maxIdleThreads = Preferences::GetInt(PREF_WORKERS_MAX_IDLE_THREADS,
+                                               MAX_IDLE_THREADS);
+  gMaxIdleThreads = std::max(0, maxIdleThreads);
+
+  int32_t idleThreadTimeout =
+    Preferences::GetInt(PREF_WORKERS_IDLE_THREAD_TIMEOUT,
+                        IDLE_THREAD_TIMEOUT_SEC);
+  // The idle thread timer takes milliseconds as a uint32_t, so cap the timeout
+  // at what fits in there (about 49 days).
+  gIdleThreadTimeoutSec =
+    std::min(uint32_t(std::max(0, idleThreadTimeout)), UINT32_MAX / 1000);
+
+  // Spawn some threads up front so that the first workers created don't have
+  // to pay for thread creation. They expire like any other idle thread.
+  int32_t prewarmThreads =
+    Preferences::GetInt(PREF_WORKERS_PREWARM_THREADS, 0);
+  uint32_t prewarmCount =
+    std::min(uint32_t(std::max(0, prewarmThreads)), gMaxIdleThreads);
+
+  const WorkerThreadFriendKey friendKey;
+  for (uint32_t index = 0; index < prewarmCount; index++) {
+    RefPtr<WorkerThread> thread = WorkerThread::Create(friendKey);
+    if (!thread) {
+      NS_WARNING("Failed to prewarm worker thread!");
+      break;
+    }
+    NoteIdleThread(thread);
+  }
+
   rv = InitOSFileConstants();
   if (NS_FAILED(rv)) {
     return rv;
@@ -2514,8 +2550,7 @@ RuntimeService::NoteIdleThread(WorkerThread* aThread)
   bool scheduleTimer = false;
 
   if (!shutdownThread) {
-    static TimeDuration timeout =
-      TimeDuration::FromSeconds(IDLE_THREAD_TIMEOUT_SEC);
+    TimeDuration timeout = TimeDuration::FromSeconds(gIdleThreadTimeoutSec);
 
     TimeStamp expirationTime = TimeStamp::NowLoRes() + timeout;
 
@@ -2523,7 +2558,7 @@ RuntimeService::NoteIdleThread(WorkerThread* aThread)
 
     uint32_t previousIdleCount = mIdleThreadArray.Length();
 
-    if (previousIdleCount < MAX_IDLE_THREADS) {
+    if (previousIdleCount < gMaxIdleThreads) {
       IdleThreadInfo* info = mIdleThreadArray.AppendElement();
       info->mThread = aThread;
       info->mExpirationTime = expirationTime;
@@ -2544,7 +2579,7 @@ RuntimeService::NoteIdleThread(WorkerThread* aThread)
     MOZ_ALWAYS_SUCCEEDS(
       mIdleThreadTimer->InitWithNamedFuncCallback(ShutdownIdleThreads,
                                                   nullptr,
-                                                  IDLE_THREAD_TIMEOUT_SEC * 1000,
+                                                  gIdleThreadTimeoutSec * 1000,
                                                   nsITimer::TYPE_ONE_SHOT,
                                                   "RuntimeService::ShutdownIdleThreads"));
   }
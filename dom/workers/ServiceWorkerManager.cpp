@@ -2872,6 +2872,20 @@ ServiceWorkerManager::IsControlled(nsIDocument* aDoc, ErrorResult& aRv)
   return !!registration;
 }
 
+bool
+ServiceWorkerManager::ControllerHandlesFetch(nsIDocument* aDoc)
+{
+  MOZ_ASSERT(aDoc);
+
+  RefPtr<ServiceWorkerRegistrationInfo> registration;
+  nsresult rv = GetDocumentRegistration(aDoc, getter_AddRefs(registration));
+  if (NS_FAILED(rv)) {
+    return false;
+  }
+
+  return registration->GetActive()->HandlesFetch();
+}
+
 nsresult
 ServiceWorkerManager::GetDocumentRegistration(nsIDocument* aDoc,
                                               ServiceWorkerRegistrationInfo** aRegistrationInfo)
@@ -131,6 +131,13 @@ public:
   bool
   IsControlled(nsIDocument* aDocument, ErrorResult& aRv);
 
+  // Return true if the active worker of the registration controlling the
+  // given document has a fetch event handler.  Subresource requests from a
+  // controlled document whose worker doesn't handle fetch events would just
+  // be reset to the network, so they don't need to be intercepted at all.
+  bool
+  ControllerHandlesFetch(nsIDocument* aDocument);
+
   // Return true if the given content process could potentially be executing
   // service worker code with the given principal.  At the current time, this
   // just means that we have any registration for the origin, regardless of
@@ -1349,7 +1349,8 @@ DrawTargetSkia::DrawGlyphs(ScaledFont* aFont,
                            const DrawOptions& aOptions,
                            const GlyphRenderingOptions* aRenderingOptions)
 {
-  if (!CanDrawFont(aFont)) {
+  // Avoid detaching a snapshot (see MarkChanged) when there's nothing to draw.
+  if (!aBuffer.mNumGlyphs || !CanDrawFont(aFont)) {
     return;
   }
 
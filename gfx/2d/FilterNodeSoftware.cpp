@@ -2956,6 +2956,20 @@ FilterNodeBlurXYSoftware::InputIndex(uint32_t aInputEnumIndex)
   }
 }
 
+static bool
+IsChannelZero(const DataSourceSurface::ScopedMap& aMap, const IntSize& aSize)
+{
+  const uint8_t* row = aMap.GetData();
+  for (int32_t y = 0; y < aSize.height; y++, row += aMap.GetStride()) {
+    for (int32_t x = 0; x < aSize.width; x++) {
+      if (row[x]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 already_AddRefed<DataSourceSurface>
 FilterNodeBlurXYSoftware::Render(const IntRect& aRect)
 {
@@ -3005,11 +3019,22 @@ FilterNodeBlurXYSoftware::Render(const IntRect& aRect)
         return nullptr;
       }
 
+      // Blurring a channel that is zero everywhere leaves it unchanged, which
+      // is common for the color channels of black shadows, so skip those.
       AlphaBoxBlur blur(r, channel0Map.GetStride(), sigmaXY.width, sigmaXY.height);
-      blur.Blur(channel0Map.GetData());
-      blur.Blur(channel1Map.GetData());
-      blur.Blur(channel2Map.GetData());
-      blur.Blur(channel3Map.GetData());
+      IntSize size = srcRect.Size();
+      if (!IsChannelZero(channel0Map, size)) {
+        blur.Blur(channel0Map.GetData());
+      }
+      if (!IsChannelZero(channel1Map, size)) {
+        blur.Blur(channel1Map.GetData());
+      }
+      if (!IsChannelZero(channel2Map, size)) {
+        blur.Blur(channel2Map.GetData());
+      }
+      if (!IsChannelZero(channel3Map, size)) {
+        blur.Blur(channel3Map.GetData());
+      }
     }
     target = FilterProcessing::CombineColorChannels(channel0, channel1, channel2, channel3);
   }
@@ -3310,6 +3310,12 @@ public:
      */
     virtual bool SwapBuffers() { return false; }
 
+    /**
+     * Returns the number of frames since the contents of the current back
+     * buffer were presented, or 0 if its contents are undefined.
+     */
+    virtual GLint GetBufferAge() const { return 0; }
+
     /**
      * Defines a two-dimensional texture image for context target surface
      */
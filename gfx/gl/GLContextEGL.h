@@ -85,6 +85,8 @@ public:
 
     virtual bool SwapBuffers() override;
 
+    virtual GLint GetBufferAge() const override;
+
     virtual void GetWSIInfo(nsCString* const out) const override;
 
     // hold a reference to the given surface
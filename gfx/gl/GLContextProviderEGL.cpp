@@ -425,6 +425,28 @@ GLContextEGL::SwapBuffers()
     }
 }
 
+GLint
+GLContextEGL::GetBufferAge() const
+{
+    if (!sEGLLibrary.IsExtensionSupported(GLLibraryEGL::EXT_buffer_age)) {
+        return 0;
+    }
+
+    EGLSurface surface = mSurfaceOverride != EGL_NO_SURFACE
+                          ? mSurfaceOverride
+                          : mSurface;
+    if (!surface) {
+        return 0;
+    }
+
+    EGLint result;
+    if (!sEGLLibrary.fQuerySurface(EGL_DISPLAY(), surface,
+                                   LOCAL_EGL_BUFFER_AGE_EXT, &result)) {
+        return 0;
+    }
+    return result;
+}
+
 void
 GLContextEGL::GetWSIInfo(nsCString* const out) const
 {
@@ -57,6 +57,7 @@ static const char* sEGLExtensionNames[] = {
     "EGL_EXT_device_query",
     "EGL_NV_stream_consumer_gltexture_yuv",
     "EGL_ANGLE_stream_producer_d3d_texture_nv12",
+    "EGL_EXT_buffer_age",
 };
 
 #if defined(ANDROID)
@@ -111,6 +111,7 @@ public:
         EXT_device_query,
         NV_stream_consumer_gltexture_yuv,
         ANGLE_stream_producer_d3d_texture_nv12,
+        EXT_buffer_age,
         Extensions_Max
     };
 
@@ -14,6 +14,7 @@
 #include "ScopedGLHelpers.h"
 
 #include "mozilla/gfx/2D.h"
+#include "mozilla/gfx/Swizzle.h"
 #include "mozilla/Move.h"
 
 namespace mozilla {
@@ -227,28 +228,19 @@ SwapRAndBComponents(DataSourceSurface* surf)
     }
     MOZ_ASSERT(map.mStride >= 0);
 
-    const size_t rowBytes = surf->GetSize().width*4;
-    const size_t rowHole = map.mStride - rowBytes;
-
-    uint8_t* row = map.mData;
-    if (!row) {
+    if (!map.mData) {
         MOZ_ASSERT(false, "SwapRAndBComponents: Failed to get data from"
                           " DataSourceSurface.");
         surf->Unmap();
         return;
     }
 
-    const size_t rows = surf->GetSize().height;
-    for (size_t i = 0; i < rows; i++) {
-        const uint8_t* rowEnd = row + rowBytes;
-
-        while (row != rowEnd) {
-            Swap(row[0], row[2]);
-            row += 4;
-        }
-
-        row += rowHole;
-    }
+    // Swapping R and B while leaving the other two channels alone is exactly
+    // a BGRA to RGBA swizzle, which SwizzleData does in place with SIMD where
+    // available.
+    SwizzleData(map.mData, map.mStride, SurfaceFormat::B8G8R8A8,
+                map.mData, map.mStride, SurfaceFormat::R8G8B8A8,
+                surf->GetSize());
 
     surf->Unmap();
 }
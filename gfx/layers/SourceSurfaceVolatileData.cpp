@@ -7,11 +7,135 @@
 
 #include "gfxAlphaRecovery.h"
 #include "mozilla/Likely.h"
+#include "mozilla/StaticMutex.h"
+#include "mozilla/StaticPtr.h"
 #include "mozilla/Types.h" // for decltype
+#include "nsIMemoryReporter.h"
+#include "nsTArray.h"
 
 namespace mozilla {
 namespace gfx {
 
+// Volatile buffers released by destroyed surfaces, ordered from least to most
+// recently released. Mapping a new ashmem or purgeable region is much more
+// expensive than reusing one, and image decoding tends to create many
+// surfaces of the same size. The pooled buffers are unlocked, so the OS may
+// still reclaim their pages; only the mapping is kept. Heap-backed buffers
+// are never pooled.
+//
+// The pool is bounded both in buffers and in bytes, so that a few huge
+// surfaces can't pin a large amount of address space and, where purging is
+// lazy, memory. Buffers bigger than the byte limit are never pooled.
+static StaticMutex sBufferPoolMutex;
+static StaticAutoPtr<nsTArray<RefPtr<VolatileBuffer>>> sBufferPool;
+static size_t sBufferPoolBytes = 0;
+static bool sBufferPoolShutdown = false;
+static const size_t kMaxPooledBuffers = 8;
+static const size_t kMaxPooledBytes = 16 * 1024 * 1024;
+
+class VolatileBufferPoolReporter final : public nsIMemoryReporter
+{
+  ~VolatileBufferPoolReporter() {}
+
+public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+
+  NS_IMETHOD CollectReports(nsIHandleReportCallback* aHandleReport,
+                            nsISupports* aData, bool aAnonymize) override
+  {
+    size_t amount;
+    {
+      StaticMutexAutoLock lock(sBufferPoolMutex);
+      amount = sBufferPoolBytes;
+    }
+
+    MOZ_COLLECT_REPORT(
+      "explicit/gfx/volatile-buffer-pool", KIND_NONHEAP, UNITS_BYTES, amount,
+      "Volatile buffers kept for reuse after their surfaces were destroyed. "
+      "The operating system may already have reclaimed some of their pages.");
+
+    return NS_OK;
+  }
+};
+
+NS_IMPL_ISUPPORTS(VolatileBufferPoolReporter, nsIMemoryReporter)
+
+static already_AddRefed<VolatileBuffer>
+TakePooledBuffer(size_t aSize)
+{
+  StaticMutexAutoLock lock(sBufferPoolMutex);
+  if (!sBufferPool) {
+    return nullptr;
+  }
+
+  // Prefer the most recently released buffer, its pages are the least
+  // likely to have been purged.
+  for (size_t i = sBufferPool->Length(); i > 0; --i) {
+    if ((*sBufferPool)[i - 1]->Size() == aSize) {
+      RefPtr<VolatileBuffer> buf = (*sBufferPool)[i - 1].forget();
+      sBufferPool->RemoveElementAt(i - 1);
+      sBufferPoolBytes -= aSize;
+      return buf.forget();
+    }
+  }
+  return nullptr;
+}
+
+static void
+ReturnPooledBuffer(already_AddRefed<VolatileBuffer> aBuffer)
+{
+  RefPtr<VolatileBuffer> buf = aBuffer;
+  size_t size = buf->Size();
+  if (size > kMaxPooledBytes) {
+    return;
+  }
+
+  // Evicted buffers are released outside of the lock.
+  nsTArray<RefPtr<VolatileBuffer>> evicted;
+
+  StaticMutexAutoLock lock(sBufferPoolMutex);
+  if (sBufferPoolShutdown) {
+    return;
+  }
+  if (!sBufferPool) {
+    sBufferPool = new nsTArray<RefPtr<VolatileBuffer>>(kMaxPooledBuffers);
+  }
+  while (sBufferPool->Length() == kMaxPooledBuffers ||
+         sBufferPoolBytes + size > kMaxPooledBytes) {
+    sBufferPoolBytes -= (*sBufferPool)[0]->Size();
+    evicted.AppendElement((*sBufferPool)[0].forget());
+    sBufferPool->RemoveElementAt(0);
+  }
+  sBufferPool->AppendElement(buf.forget());
+  sBufferPoolBytes += size;
+}
+
+/* static */ void
+SourceSurfaceVolatileData::InitBufferPool()
+{
+  RegisterStrongMemoryReporter(new VolatileBufferPoolReporter());
+}
+
+/* static */ void
+SourceSurfaceVolatileData::PurgeBufferPool()
+{
+  nsTArray<RefPtr<VolatileBuffer>> buffers;
+  StaticMutexAutoLock lock(sBufferPoolMutex);
+  if (sBufferPool) {
+    buffers.SwapElements(*sBufferPool);
+  }
+  sBufferPoolBytes = 0;
+}
+
+/* static */ void
+SourceSurfaceVolatileData::ShutdownBufferPool()
+{
+  StaticMutexAutoLock lock(sBufferPoolMutex);
+  sBufferPoolShutdown = true;
+  sBufferPool = nullptr;
+  sBufferPoolBytes = 0;
+}
+
 bool
 SourceSurfaceVolatileData::Init(const IntSize &aSize,
                                 int32_t aStride,
@@ -21,9 +145,22 @@ SourceSurfaceVolatileData::Init(const IntSize &aSize,
   mStride = aStride;
   mFormat = aFormat;
 
+  // Every buffer is allocated with the same alignment, so pooled buffers
+  // only need to match in size.
+  size_t size = aStride * aSize.height;
+  mVBuf = TakePooledBuffer(size);
+  if (mVBuf) {
+    // A fresh mapping is zero-filled, and callers rely on that; see
+    // ClearSurface in imgFrame.cpp. The pages are already faulted in, so
+    // clearing them is still cheaper than mapping a new region.
+    VolatileBufferPtr<uint8_t> ptr(mVBuf);
+    memset(ptr, 0, size);
+    return true;
+  }
+
   size_t alignment = size_t(1) << gfxAlphaRecovery::GoodAlignmentLog2();
   mVBuf = new VolatileBuffer();
-  if (MOZ_UNLIKELY(!mVBuf->Init(aStride * aSize.height, alignment))) {
+  if (MOZ_UNLIKELY(!mVBuf->Init(size, alignment))) {
     mVBuf = nullptr;
     return false;
   }
@@ -31,6 +168,15 @@ SourceSurfaceVolatileData::Init(const IntSize &aSize,
   return true;
 }
 
+SourceSurfaceVolatileData::~SourceSurfaceVolatileData()
+{
+  MOZ_ASSERT(mMapCount == 0);
+
+  if (mVBuf && !mVBuf->OnHeap()) {
+    ReturnPooledBuffer(mVBuf.forget());
+  }
+}
+
 void
 SourceSurfaceVolatileData::GuaranteePersistance()
 {
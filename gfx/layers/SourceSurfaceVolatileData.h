@@ -52,6 +52,13 @@ public:
                               size_t& aHeapSizeOut,
                               size_t& aNonHeapSizeOut) const override;
 
+  // Registers the memory reporter for the volatile buffers kept for reuse by
+  // Init(). PurgeBufferPool releases them and is called under memory
+  // pressure; ShutdownBufferPool also stops further pooling.
+  static void InitBufferPool();
+  static void PurgeBufferPool();
+  static void ShutdownBufferPool();
+
   bool OnHeap() const override
   {
     return mVBuf->OnHeap();
@@ -88,10 +95,7 @@ public:
   }
 
 private:
-  ~SourceSurfaceVolatileData() override
-  {
-    MOZ_ASSERT(mMapCount == 0);
-  }
+  ~SourceSurfaceVolatileData() override;
 
   Mutex mMutex;
   int32_t mStride;
@@ -313,6 +313,7 @@ APZCTreeManager::UpdateHitTestingTreeImpl(uint64_t aRootLayerTreeId,
       });
   state.mLayersIdsToDestroy = mFocusState.GetFocusTargetLayerIds();
   mRootNode = nullptr;
+  RebuildGuidToNodeMaps();
 
   if (aRoot) {
     std::stack<gfx::TreeAutoIndent> indents;
@@ -394,6 +395,8 @@ APZCTreeManager::UpdateHitTestingTreeImpl(uint64_t aRootLayerTreeId,
     state.mNodesToDestroy[i]->Destroy();
   }
 
+  RebuildGuidToNodeMaps();
+
   // Clear out any focus targets that are no longer needed
   for (auto layersId : state.mLayersIdsToDestroy) {
     mFocusState.RemoveFocusTarget(layersId);
@@ -1800,6 +1803,7 @@ APZCTreeManager::ClearTree()
     nodesToDestroy[i]->Destroy();
   }
   mRootNode = nullptr;
+  RebuildGuidToNodeMaps();
 
   RefPtr<APZCTreeManager> self(this);
   NS_DispatchToMainThread(
@@ -2035,6 +2039,20 @@ APZCTreeManager::GetTargetNode(const ScrollableLayerGuid& aGuid,
                                GuidComparator aComparator) const
 {
   mTreeLock.AssertCurrentThreadOwns();
+
+  // The two comparisons used by callers are answered from the maps built in
+  // RebuildGuidToNodeMaps, rather than by searching the whole tree.
+  if (!aComparator || aComparator == &GuidComparatorIgnoringPresShell) {
+    ScrollableLayerGuid key(aGuid);
+    const auto& map = aComparator ? mGuidIgnoringPresShellToNode : mGuidToNode;
+    if (aComparator) {
+      key.mPresShellId = 0;
+    }
+    auto it = map.find(key);
+    RefPtr<HitTestingTreeNode> target = it != map.end() ? it->second : nullptr;
+    return target.forget();
+  }
+
   RefPtr<HitTestingTreeNode> target = DepthFirstSearchPostOrder<ReverseIterator>(mRootNode.get(),
       [&aGuid, &aComparator](HitTestingTreeNode* node)
       {
@@ -2052,6 +2070,29 @@ APZCTreeManager::GetTargetNode(const ScrollableLayerGuid& aGuid,
   return target.forget();
 }
 
+void
+APZCTreeManager::RebuildGuidToNodeMaps()
+{
+  mTreeLock.AssertCurrentThreadOwns();
+
+  mGuidToNode.clear();
+  mGuidIgnoringPresShellToNode.clear();
+
+  // Visit the nodes in the same order as the search in GetTargetNode, and keep
+  // the first node found for each guid, so that lookups return the same node
+  // the search would.
+  ForEachNodePostOrder<ReverseIterator>(mRootNode.get(),
+      [this](HitTestingTreeNode* aNode)
+      {
+        if (AsyncPanZoomController* apzc = aNode->GetApzc()) {
+          ScrollableLayerGuid guid = apzc->GetGuid();
+          mGuidToNode.emplace(guid, aNode);
+          guid.mPresShellId = 0;
+          mGuidIgnoringPresShellToNode.emplace(guid, aNode);
+        }
+      });
+}
+
 already_AddRefed<AsyncPanZoomController>
 APZCTreeManager::GetTargetAPZC(const ScreenPoint& aPoint,
                                HitTestResult* aOutHitResult,
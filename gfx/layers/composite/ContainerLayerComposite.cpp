@@ -213,9 +213,20 @@ ContainerPrepare(ContainerT* aContainer,
       continue;
     }
 
-    // We don't want to skip container layers because otherwise their mPrepared
-    // may be null which is not allowed.
-    if (!layerToRender->GetLayer()->AsContainerLayer()) {
+    // We don't want to skip container layers participating in a 3D rendering
+    // context, because otherwise their mPrepared may be null which is not
+    // allowed. Containers without an intermediate surface are passed through
+    // by LayerManagerComposite::PostProcessLayers, which leaves their shadow
+    // visible region as the content side sent it, so they can't be culled on
+    // it either. Other containers are never rendered once they've been
+    // skipped here, so they can be culled like any other layer when they're
+    // entirely occluded or clipped out.
+    Layer* sublayer = layerToRender->GetLayer();
+    ContainerLayer* subcontainer = sublayer->AsContainerLayer();
+    if (!subcontainer ||
+        (subcontainer->UseIntermediateSurface() &&
+         !sublayer->Extend3DContext() &&
+         !sublayer->Combines3DTransformWithAncestors())) {
       if (!layerToRender->GetLayer()->IsVisible()) {
         CULLING_LOG("Sublayer %p has no effective visible region\n", layerToRender->GetLayer());
         continue;
@@ -9,6 +9,7 @@
 #include <stdlib.h>                     // for free, malloc
 #include "GLContextProvider.h"          // for GLContextProvider
 #include "GLContext.h"                  // for GLContext
+#include "GLContextEGL.h"               // for GLContextEGL
 #include "GLUploadHelpers.h"
 #include "Layers.h"                     // for WriteSnapshotToDumpFile
 #include "LayerScope.h"                 // for LayerScope
@@ -62,6 +63,9 @@ using namespace mozilla::gl;
 static const GLuint kCoordinateAttributeIndex = 0;
 static const GLuint kTexCoordinateAttributeIndex = 1;
 
+// The number of past frames whose damage we remember for partial presents.
+static const size_t kMaxFrameDamageHistory = 3;
+
 static void
 BindMaskForProgram(ShaderProgramOGL* aProgram, TextureSourceOGL* aSourceMask,
                    GLenum aTexUnit, const gfx::Matrix4x4& aTransform)
@@ -627,6 +631,23 @@ CompositorOGL::ClearRect(const gfx::Rect& aRect)
   mGLContext->fClear(LOCAL_GL_COLOR_BUFFER_BIT | LOCAL_GL_DEPTH_BUFFER_BIT);
 }
 
+/* static */ IntRect
+CompositorOGL::ComputeBufferAgeDamage(const nsIntRegion& aInvalidRegion,
+                                      const nsTArray<nsIntRegion>& aDamageHistory,
+                                      GLint aBufferAge,
+                                      const IntRect& aWindowRect)
+{
+  if (aBufferAge <= 0 || size_t(aBufferAge) > aDamageHistory.Length() + 1) {
+    return aWindowRect;
+  }
+
+  nsIntRegion damage = aInvalidRegion;
+  for (GLint i = 0; i < aBufferAge - 1; i++) {
+    damage.OrWith(aDamageHistory[i]);
+  }
+  return damage.GetBounds().Intersect(aWindowRect);
+}
+
 void
 CompositorOGL::BeginFrame(const nsIntRegion& aInvalidRegion,
                           const IntRect *aClipRectIn,
@@ -670,10 +691,39 @@ CompositorOGL::BeginFrame(const nsIntRegion& aInvalidRegion,
 
     mWidgetSize.width = width;
     mWidgetSize.height = height;
+    mFrameDamageHistory.Clear();
   } else {
     MakeCurrent();
   }
 
+  // Work out how much of the window we need to recomposite. If partial
+  // presents are enabled and the back buffer still holds a frame we know
+  // about, that is the area damaged in this frame and in every frame since
+  // the one the back buffer holds. Otherwise it's the whole window.
+  //
+  // Frames drawn to a surface override (such as the presentation surface) or
+  // read back into mTarget don't advance the window's buffer ages, and frames
+  // drawn with a clip recomposite less than their invalid region, so none of
+  // them can be remembered and they make the history we have unusable.
+  IntRect windowRect(0, 0, width, height);
+  IntRect damageRect = windowRect;
+  bool surfaceOverride =
+    mGLContext->GetContextType() == GLContextType::EGL &&
+    GLContextEGL::Cast(mGLContext)->GetEGLSurfaceOverride() != EGL_NO_SURFACE;
+  if (gfxPrefs::PartialPresent() > 0 && !aClipRectIn && !mTarget &&
+      !surfaceOverride && rect.TopLeft() == IntPoint(0, 0)) {
+    nsIntRegion invalidRegion;
+    invalidRegion.And(aInvalidRegion, windowRect);
+    damageRect = ComputeBufferAgeDamage(invalidRegion, mFrameDamageHistory,
+                                        mGLContext->GetBufferAge(), windowRect);
+    mFrameDamageHistory.InsertElementAt(0, Move(invalidRegion));
+    if (mFrameDamageHistory.Length() > kMaxFrameDamageHistory) {
+      mFrameDamageHistory.TruncateLength(kMaxFrameDamageHistory);
+    }
+  } else {
+    mFrameDamageHistory.Clear();
+  }
+
   mPixelsPerFrame = width * height;
   mPixelsFilled = 0;
 
@@ -696,9 +746,15 @@ CompositorOGL::BeginFrame(const nsIntRegion& aInvalidRegion,
 #endif
 
   if (aClipRectOut && !aClipRectIn) {
-    aClipRectOut->SetRect(0, 0, width, height);
+    *aClipRectOut = damageRect;
   }
 
+  // Map damageRect to OGL coordinates, origin:bottom-left
+  GLint y = height - damageRect.YMost();
+
+  ScopedGLState scopedScissorTestState(mGLContext, LOCAL_GL_SCISSOR_TEST, true);
+  ScopedScissorRect autoScissorRect(mGLContext, damageRect.x, y,
+                                    damageRect.Width(), damageRect.Height());
   mGLContext->fClearColor(mClearColor.r, mClearColor.g, mClearColor.b, mClearColor.a);
   mGLContext->fClear(LOCAL_GL_COLOR_BUFFER_BIT | LOCAL_GL_DEPTH_BUFFER_BIT);
 }
@@ -248,6 +248,18 @@ public:
     return mRenderOffset;
   }
 
+  /**
+   * Returns the area of aWindowRect to recomposite when the back buffer is
+   * aBufferAge frames old: the bounds of aInvalidRegion and of the invalid
+   * regions of the aBufferAge - 1 frames before this one, which aDamageHistory
+   * lists newest first. If the back buffer's contents are undefined or older
+   * than the history, that is the whole window.
+   */
+  static gfx::IntRect ComputeBufferAgeDamage(const nsIntRegion& aInvalidRegion,
+                                             const nsTArray<nsIntRegion>& aDamageHistory,
+                                             GLint aBufferAge,
+                                             const gfx::IntRect& aWindowRect);
+
 private:
   template<typename Geometry>
   void DrawGeometry(const Geometry& aGeometry,
@@ -308,6 +320,15 @@ private:
    */
   bool mFrameInProgress;
 
+  /**
+   * The invalid regions of the most recent frames rendered to the window,
+   * newest first. When the back buffer still holds one of those frames only
+   * the area damaged since then needs to be recomposited. Buffer ages belong
+   * to the window's own surface, so this is emptied whenever a frame is drawn
+   * anywhere else or without a partial present.
+   */
+  nsTArray<nsIntRegion> mFrameDamageHistory;
+
   /*
    * Clear aRect on current render target.
    */
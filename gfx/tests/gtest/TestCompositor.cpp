@@ -207,3 +207,80 @@ TEST(Gfx, CompositorSimpleTree)
   }
 }
 
+
+TEST(Gfx, CompositorOGLBufferAgeDamage)
+{
+  const IntRect window(0, 0, gCompWidth, gCompHeight);
+  const nsIntRegion current(IntRect(0, 0, 10, 10));
+
+  // Damage of the previous frames, newest first.
+  nsTArray<nsIntRegion> history;
+  history.AppendElement(nsIntRegion(IntRect(20, 20, 10, 10)));
+  history.AppendElement(nsIntRegion(IntRect(40, 40, 10, 10)));
+
+  // Undefined contents, or contents older than the history, need a full
+  // recomposite.
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, 0, window), window);
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, -1, window), window);
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, 4, window), window);
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, nsTArray<nsIntRegion>(), 2, window),
+            window);
+
+  // The back buffer holds the previous frame: only this frame's damage.
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, 1, window),
+            IntRect(0, 0, 10, 10));
+
+  // Older back buffers add the damage of every frame since.
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, 2, window),
+            IntRect(0, 0, 30, 30));
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, 3, window),
+            IntRect(0, 0, 50, 50));
+
+  // Nothing invalid in a frame whose back buffer is current.
+  EXPECT_TRUE(CompositorOGL::ComputeBufferAgeDamage(nsIntRegion(), history, 1, window).IsEmpty());
+
+  // Damage is clipped to the window.
+  history[0] = nsIntRegion(IntRect(gCompWidth - 5, 0, 10, 10));
+  EXPECT_EQ(CompositorOGL::ComputeBufferAgeDamage(current, history, 2, window),
+            IntRect(0, 0, gCompWidth, 10));
+}
+
+TEST(Gfx, CompositorPassThroughContainerNotCulled)
+{
+  auto layerManagers = GetLayerManagers(GetPlatformBackends());
+  for (size_t i = 0; i < layerManagers.size(); i++) {
+    RefPtr<LayerManagerComposite> layerManager = layerManagers[i].mLayerManager;
+    RefPtr<LayerManager> lmBase = layerManager.get();
+    nsTArray<RefPtr<Layer>> layers;
+    nsIntRegion layerVisibleRegion[] = {
+      nsIntRegion(IntRect(0, 0, gCompWidth, gCompHeight)),
+      nsIntRegion(IntRect(0, 0, gCompWidth, gCompHeight)),
+      nsIntRegion(IntRect(0, 0, 100, 100)),
+      nsIntRegion(IntRect(0, 0, 100, 100)),
+    };
+    RefPtr<Layer> root = CreateLayerTree("c(oc(o))", layerVisibleRegion, nullptr, lmBase, layers);
+
+    { // background
+      ColorLayer* colorLayer = layers[1]->AsColorLayer();
+      colorLayer->SetColor(Color(1.f, 0.f, 1.f, 1.f));
+      colorLayer->SetBounds(colorLayer->GetVisibleRegion().ToUnknownRegion().GetBounds());
+    }
+
+    {
+      ColorLayer* colorLayer = layers[3]->AsColorLayer();
+      colorLayer->SetColor(Color(0.f, 0.f, 1.f, 1.f));
+      colorLayer->SetBounds(colorLayer->GetVisibleRegion().ToUnknownRegion().GetBounds());
+    }
+
+    // The inner container needs no intermediate surface, so PostProcessLayers
+    // passes through it without recomputing its visible region. Leave a stale,
+    // empty one there: it must not make the container look invisible.
+    static_cast<LayerComposite*>(layers[2]->AsHostLayer())->
+      SetShadowVisibleRegion(LayerIntRegion());
+
+    RefPtr<DrawTarget> refDT = CreateDT();
+    refDT->FillRect(Rect(0, 0, gCompWidth, gCompHeight), ColorPattern(Color(1.f, 0.f, 1.f, 1.f)));
+    refDT->FillRect(Rect(0, 0, 100, 100), ColorPattern(Color(0.f, 0.f, 1.f, 1.f)));
+    EXPECT_TRUE(CompositeAndCompare(layerManager, refDT));
+  }
+}
@@ -1227,6 +1227,7 @@ gfxFcPlatformFontList::gfxFcPlatformFontList()
     , mFcSubstituteCache(64)
     , mLastConfig(nullptr)
     , mAlwaysUseFontconfigGenerics(true)
+    , mLocalNamesInitialized(false)
 {
     // if the rescan interval is set, start the timer
     int rescanInterval = FcConfigGetRescanInterval(nullptr);
@@ -1327,6 +1328,28 @@ gfxFcPlatformFontList::AddFontSetFamilies(FcFontSet* aFontSet, bool aAppFonts)
 
         NS_ASSERTION(fontFamily, "font must belong to a font family");
         fontFamily->AddFontPattern(font);
+    }
+}
+
+void
+gfxFcPlatformFontList::AddFontSetLocalNames(FcFontSet* aFontSet)
+{
+    if (!aFontSet) {
+        return;
+    }
+
+    nsAutoString familyName;
+    for (int f = 0; f < aFontSet->nfont; f++) {
+        FcPattern* font = aFontSet->fonts[f];
+
+        uint32_t cIndex = FindCanonicalNameIndex(font, FC_FAMILYLANG);
+        FcChar8* canonical = nullptr;
+        FcPatternGetString(font, FC_FAMILY, cIndex, &canonical);
+        if (!canonical) {
+            continue;
+        }
+        familyName.Truncate();
+        AppendUTF8toUTF16(ToCharPtr(canonical), familyName);
 
         // map the psname, fullname ==> font family for local font lookups
         nsAutoString psname, fullname;
@@ -1342,12 +1365,29 @@ gfxFcPlatformFontList::AddFontSetFamilies(FcFontSet* aFontSet, bool aAppFonts)
     }
 }
 
+void
+gfxFcPlatformFontList::InitLocalNames()
+{
+    if (mLocalNamesInitialized) {
+        return;
+    }
+    mLocalNamesInitialized = true;
+
+    AddFontSetLocalNames(FcConfigGetFonts(nullptr, FcSetSystem));
+#ifdef MOZ_BUNDLED_FONTS
+    AddFontSetLocalNames(FcConfigGetFonts(nullptr, FcSetApplication));
+#endif
+}
+
 nsresult
 gfxFcPlatformFontList::InitFontListForPlatform()
 {
     mLastConfig = FcConfigGetCurrent();
 
+    // the psname/fullname map is only needed for src:local() lookups, so
+    // it is built on first use rather than for every font at startup
     mLocalNames.Clear();
+    mLocalNamesInitialized = false;
     mFcSubstituteCache.Clear();
 
     // iterate over available fonts
@@ -1480,6 +1520,8 @@ gfxFcPlatformFontList::LookupLocalFont(const nsAString& aFontName,
     nsAutoString keyName(aFontName);
     ToLowerCase(keyName);
 
+    InitLocalNames();
+
     // if name is not in the global list, done
     FcPattern* fontPattern = mLocalNames.Get(keyName);
     if (!fontPattern) {
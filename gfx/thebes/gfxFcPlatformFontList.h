@@ -290,6 +290,12 @@ protected:
     // aAppFonts indicates whether this is the system or application fontset.
     void AddFontSetFamilies(FcFontSet* aFontSet, bool aAppFonts);
 
+    // Build the psname/fullname ==> font map used for local font lookups.
+    // This is deferred until the first lookup, since most pages never
+    // use src:local() and the names are costly to extract for every font.
+    void InitLocalNames();
+    void AddFontSetLocalNames(FcFontSet* aFontSet);
+
     // figure out which families fontconfig maps a generic to
     // (aGeneric assumed already lowercase)
     PrefFontList* FindGenericFamilies(const nsAString& aGeneric,
@@ -338,6 +344,9 @@ protected:
     // Note: langGroup == x-math is handled separately
     bool mAlwaysUseFontconfigGenerics;
 
+    // whether mLocalNames has been built for the current font set
+    bool mLocalNamesInitialized;
+
     static FT_Library sCairoFTLibrary;
 };
 
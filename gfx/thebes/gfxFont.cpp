@@ -2535,6 +2535,19 @@ gfxFont::AgeCachedWords()
     }
 }
 
+void
+gfxFont::RemoveUnusedCachedWords()
+{
+    if (mWordCache) {
+        for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
+            CacheHashEntry *entry = it.Get();
+            if (!entry->mShapedWord || entry->mShapedWord->Age() > 0) {
+                it.Remove();
+            }
+        }
+    }
+}
+
 void
 gfxFont::NotifyGlyphsChanged()
 {
@@ -2581,12 +2594,19 @@ gfxFont::GetShapedWord(DrawTarget *aDrawTarget,
                        RoundingFlags aRounding,
                        gfxTextPerfMetrics *aTextPerf GFX_MAYBE_UNUSED)
 {
-    // if the cache is getting too big, flush it and start over
+    // if the cache is getting too big, drop the words that haven't been used
+    // recently; content that keeps displaying the same strings (e.g. large
+    // tables) would otherwise have to reshape all of them after a flush.
+    // If that doesn't free up a good part of the cache, flush it and start
+    // over, so that we don't end up pruning it on every new word.
     uint32_t wordCacheMaxEntries =
         gfxPlatform::GetPlatform()->WordCacheMaxEntries();
     if (mWordCache->Count() > wordCacheMaxEntries) {
-        NS_WARNING("flushing shaped-word cache");
-        ClearCachedWords();
+        RemoveUnusedCachedWords();
+        if (mWordCache->Count() > wordCacheMaxEntries / 4 * 3) {
+            NS_WARNING("flushing shaped-word cache");
+            ClearCachedWords();
+        }
     }
 
     // if there's a cached entry for this word, just return it
@@ -9,6 +9,7 @@
 #include "mozilla/layers/ISurfaceAllocator.h"     // for GfxMemoryImageReporter
 #include "mozilla/webrender/RenderThread.h"
 #include "mozilla/layers/PaintThread.h"
+#include "mozilla/layers/SourceSurfaceVolatileData.h"
 #include "mozilla/gfx/gfxVars.h"
 #include "mozilla/gfx/GPUProcessManager.h"
 #include "mozilla/gfx/GraphicsMessages.h"
@@ -501,6 +502,7 @@ MemoryPressureObserver::Observe(nsISupports *aSubject,
 
     gfxPlatform::PurgeSkiaFontCache();
     gfxPlatform::GetPlatform()->PurgeSkiaGPUCache();
+    SourceSurfaceVolatileData::PurgeBufferPool();
     return NS_OK;
 }
 
@@ -845,6 +847,7 @@ gfxPlatform::Init()
     }
 
     RegisterStrongMemoryReporter(new GfxMemoryImageReporter());
+    SourceSurfaceVolatileData::InitBufferPool();
     mlg::InitializeMemoryReporters();
 
 #ifdef USE_SKIA
@@ -948,6 +951,7 @@ gfxPlatform::Shutdown()
     gfxFontCache::Shutdown();
     gfxGradientCache::Shutdown();
     gfxAlphaBoxBlur::ShutdownBlurCache();
+    SourceSurfaceVolatileData::ShutdownBufferPool();
     gfxGraphiteShaper::Shutdown();
     gfxPlatformFontList::Shutdown();
     ShutdownTileCache();
@@ -18,6 +18,10 @@
 #include "prsystem.h"
 #include "nsIXULRuntime.h"
 
+#if defined(MOZ_MEMORY)
+# include "mozmemory.h"
+#endif
+
 #include "gfxPrefs.h"
 
 #include "Decoder.h"
@@ -171,6 +175,14 @@ public:
     nsCOMPtr<nsIThread> thisThread;
     nsThreadManager::get().GetCurrentThread(getter_AddRefs(thisThread));
 
+#if defined(MOZ_MEMORY)
+    // Decoders allocate heavily from several threads at once. Give each
+    // decode thread its own jemalloc arena so they don't all contend on the
+    // lock of the shared arena. Decode threads live until shutdown, so the
+    // number of arenas stays bounded by the pool size.
+    jemalloc_thread_local_arena(true);
+#endif
+
     do {
       Work work = mImpl->PopWork();
       switch (work.mType) {
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include "mozilla/Assertions.h"
 #include "mozilla/Attributes.h"
+#include "mozilla/BinarySearch.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Likely.h"
 #include "mozilla/Move.h"
@@ -403,6 +404,10 @@ public:
     , mAvailableCost(aSurfaceCacheSize)
     , mLockedCost(0)
     , mOverflowCount(0)
+    , mEvictionCount(0)
+    , mHitCount(0)
+    , mSubstituteCount(0)
+    , mMissCount(0)
   {
     nsCOMPtr<nsIObserverService> os = services::GetObserverService();
     if (os) {
@@ -455,12 +460,25 @@ public:
       return InsertOutcome::FAILURE;
     }
 
-    // Remove elements in order of cost until we can fit this in the cache. Note
-    // that locked surfaces aren't in mCosts, so we never remove them here.
+    // Remove elements until we can fit this in the cache. If a single surface
+    // would free up enough space, we evict the smallest such surface rather
+    // than the largest one, so we don't throw away more decoded data than we
+    // need to. Note that locked surfaces aren't in mCosts, so we never remove
+    // them here.
     while (cost > mAvailableCost) {
       MOZ_ASSERT(!mCosts.IsEmpty(),
                  "Removed everything and it still won't fit");
-      Remove(mCosts.LastElement().Surface(), aAutoLock);
+      const Cost needed = cost - mAvailableCost;
+      size_t index;
+      BinarySearchIf(mCosts, 0, mCosts.Length(),
+                     [=](const CostEntry& aEntry) {
+                       return needed <= aEntry.GetCost() ? -1 : 1;
+                     }, &index);
+      if (index == mCosts.Length()) {
+        index = mCosts.Length() - 1;
+      }
+      Remove(mCosts[index].Surface(), aAutoLock);
+      mEvictionCount++;
     }
 
     // Locate the appropriate per-image cache. If there's not an existing cache
@@ -669,6 +687,24 @@ public:
     return LookupResult(Move(drawableSurface), matchType);
   }
 
+  void RecordLookup(MatchType aMatchType,
+                    const StaticMutexAutoLock& aAutoLock)
+  {
+    switch (aMatchType) {
+      case MatchType::EXACT:
+        mHitCount++;
+        break;
+      case MatchType::SUBSTITUTE_BECAUSE_NOT_FOUND:
+      case MatchType::SUBSTITUTE_BECAUSE_PENDING:
+        mSubstituteCount++;
+        break;
+      case MatchType::NOT_FOUND:
+      case MatchType::PENDING:
+        mMissCount++;
+        break;
+    }
+  }
+
   bool CanHold(const Cost aCost) const
   {
     return aCost <= mMaxCost;
@@ -843,6 +879,28 @@ public:
 "Count of how many times the surface cache has hit its capacity and been "
 "unable to insert a new surface.");
 
+    MOZ_COLLECT_REPORT(
+      "imagelib-surface-cache-evictions",
+      KIND_OTHER, UNITS_COUNT_CUMULATIVE, mEvictionCount,
+"Count of surfaces the surface cache has evicted to make room for new "
+"surfaces.");
+
+    MOZ_COLLECT_REPORT(
+      "imagelib-surface-cache-hits",
+      KIND_OTHER, UNITS_COUNT_CUMULATIVE, mHitCount,
+"Count of surface cache lookups that found an exact match.");
+
+    MOZ_COLLECT_REPORT(
+      "imagelib-surface-cache-substitutes",
+      KIND_OTHER, UNITS_COUNT_CUMULATIVE, mSubstituteCount,
+"Count of surface cache lookups that found a substitute surface with a "
+"different size.");
+
+    MOZ_COLLECT_REPORT(
+      "imagelib-surface-cache-misses",
+      KIND_OTHER, UNITS_COUNT_CUMULATIVE, mMissCount,
+"Count of surface cache lookups that found no usable surface.");
+
     return NS_OK;
   }
 
@@ -999,6 +1057,10 @@ private:
   Cost                                    mAvailableCost;
   Cost                                    mLockedCost;
   size_t                                  mOverflowCount;
+  size_t                                  mEvictionCount;
+  size_t                                  mHitCount;
+  size_t                                  mSubstituteCount;
+  size_t                                  mMissCount;
 };
 
 NS_IMPL_ISUPPORTS(SurfaceCacheImpl, nsIMemoryReporter)
@@ -1090,6 +1152,7 @@ SurfaceCache::Lookup(const ImageKey         aImageKey,
     }
 
     rv = sInstance->Lookup(aImageKey, aSurfaceKey, lock);
+    sInstance->RecordLookup(rv.Type(), lock);
     sInstance->TakeDiscard(discard, lock);
   }
 
@@ -1110,6 +1173,7 @@ SurfaceCache::LookupBestMatch(const ImageKey         aImageKey,
     }
 
     rv = sInstance->LookupBestMatch(aImageKey, aSurfaceKey, lock);
+    sInstance->RecordLookup(rv.Type(), lock);
     sInstance->TakeDiscard(discard, lock);
   }
 
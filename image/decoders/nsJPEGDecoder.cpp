@@ -378,6 +378,13 @@ nsJPEGDecoder::ReadJPEGData(const char* aData, size_t aLength)
     mInfo.buffered_image = mDecodeStyle == PROGRESSIVE &&
                            jpeg_has_multiple_scans(&mInfo);
 
+    // If we're downscaling, let libjpeg do as much of it as possible in the
+    // DCT domain. This skips most of the IDCT and color conversion work for
+    // the discarded pixels, and the Downscaler only has to cover what's left.
+    if (mDownscaler) {
+      SetDCTScaling();
+    }
+
     /* Used to set up image size so arrays can be allocated */
     jpeg_calc_output_dimensions(&mInfo);
 
@@ -394,7 +401,8 @@ nsJPEGDecoder::ReadJPEGData(const char* aData, size_t aLength)
     MOZ_ASSERT(mImageData, "Should have a buffer now");
 
     if (mDownscaler) {
-      nsresult rv = mDownscaler->BeginFrame(Size(), Nothing(),
+      gfx::IntSize scaledSize(mInfo.output_width, mInfo.output_height);
+      nsresult rv = mDownscaler->BeginFrame(scaledSize, Nothing(),
                                             mImageData,
                                             /* aHasAlpha = */ false);
       if (NS_FAILED(rv)) {
@@ -605,6 +613,29 @@ nsJPEGDecoder::ReadOrientationFromEXIF()
   return exif.orientation;
 }
 
+void
+nsJPEGDecoder::SetDCTScaling()
+{
+  MOZ_ASSERT(mDownscaler);
+
+  // libjpeg can scale by 1/2, 1/4 or 1/8 during the IDCT. Pick the largest
+  // reduction that still leaves the image at least as large as our output
+  // size, so the Downscaler finishes off with a high quality resample. The
+  // Downscaler requires that it actually has some downscaling to do, so a
+  // reduction that lands exactly on the output size isn't used.
+  const gfx::IntSize outputSize = OutputSize();
+  for (uint32_t denom = 8; denom > 1; denom /= 2) {
+    int32_t width = (mInfo.image_width + denom - 1) / denom;
+    int32_t height = (mInfo.image_height + denom - 1) / denom;
+    if (width >= outputSize.width && height >= outputSize.height &&
+        gfx::IntSize(width, height) != outputSize) {
+      mInfo.scale_num = 1;
+      mInfo.scale_denom = denom;
+      return;
+    }
+  }
+}
+
 void
 nsJPEGDecoder::NotifyDone()
 {
@@ -722,8 +753,21 @@ nsJPEGDecoder::OutputScanlines(bool* suspend)
 
   if (mDownscaler && mDownscaler->HasInvalidation()) {
     DownscalerInvalidRect invalidRect = mDownscaler->TakeInvalidRect();
-    PostInvalidation(invalidRect.mOriginalSizeRect,
-                     Some(invalidRect.mTargetSizeRect));
+
+    // If libjpeg is scaling for us (see SetDCTScaling()), the Downscaler's
+    // input is the reduced image, so map its rect back to the image at its
+    // intrinsic size. Partial blocks at the edges round up, so clamp it.
+    nsIntRect originalSizeRect = invalidRect.mOriginalSizeRect;
+    if (mInfo.scale_denom > mInfo.scale_num) {
+      const int32_t scale = mInfo.scale_denom / mInfo.scale_num;
+      originalSizeRect = nsIntRect(originalSizeRect.x * scale,
+                                   originalSizeRect.y * scale,
+                                   originalSizeRect.width * scale,
+                                   originalSizeRect.height * scale)
+                           .Intersect(nsIntRect(nsIntPoint(), Size()));
+    }
+
+    PostInvalidation(originalSizeRect, Some(invalidRect.mTargetSizeRect));
     MOZ_ASSERT(!mDownscaler->HasInvalidation());
   } else if (!mDownscaler && top != mInfo.output_scanline) {
     PostInvalidation(nsIntRect(0, top,
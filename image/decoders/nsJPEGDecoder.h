@@ -64,6 +64,7 @@ protected:
 
 protected:
   Orientation ReadOrientationFromEXIF();
+  void SetDCTScaling();
   void OutputScanlines(bool* suspend);
 
 private:
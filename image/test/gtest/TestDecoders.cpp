@@ -192,6 +192,12 @@ CheckDownscaleDuringDecode(const ImageTestCase& aTestCase)
       return;
     }
 
+    // Invalidations are reported in the coordinate system of the image at its
+    // intrinsic size, even when a decoder does part of the downscaling itself
+    // (as the JPEG decoder does with libjpeg's DCT scaling), so a complete
+    // decode should have invalidated the whole image.
+    EXPECT_EQ(IntRect(IntPoint(), aTestCase.mSize), aDecoder->TakeInvalidRect());
+
     // Check that the downscaled image is correct. Note that we skip rows near
     // the transitions between colors, since the downscaler does not produce a
     // sharp boundary at these points. Even some of the rows we test need a
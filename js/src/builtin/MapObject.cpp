@@ -12,6 +12,7 @@
 
 #include "ds/OrderedHashTable.h"
 #include "gc/Marking.h"
+#include "jit/InlinableNatives.h"
 #include "js/Utility.h"
 #include "vm/GlobalObject.h"
 #include "vm/Interpreter.h"
@@ -330,8 +331,8 @@ const JSPropertySpec MapObject::properties[] = {
 };
 
 const JSFunctionSpec MapObject::methods[] = {
-    JS_FN("get", get, 1, 0),
-    JS_FN("has", has, 1, 0),
+    JS_INLINABLE_FN("get", get, 1, 0, MapGet),
+    JS_INLINABLE_FN("has", has, 1, 0, MapHas),
     JS_FN("set", set, 2, 0),
     JS_FN("delete", delete_, 1, 0),
     JS_FN("keys", keys, 0, 0),
@@ -1052,7 +1053,7 @@ const JSPropertySpec SetObject::properties[] = {
 };
 
 const JSFunctionSpec SetObject::methods[] = {
-    JS_FN("has", has, 1, 0),
+    JS_INLINABLE_FN("has", has, 1, 0, SetHas),
     JS_FN("add", add, 1, 0),
     JS_FN("delete", delete_, 1, 0),
     JS_FN("entries", entries, 0, 0),
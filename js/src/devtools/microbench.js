@@ -0,0 +1,305 @@
+/* -*- Mode: javascript; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * Engine microbenchmarks for the JS shell.
+ *
+ * Usage:
+ *
+ *     $ path/to/js js/src/devtools/microbench.js [options] > results.json
+ *
+ * Options (passed after the script name, and so land in scriptArgs):
+ *
+ *     --samples=N       timed samples per benchmark (default 15)
+ *     --filter=STR      only run benchmarks whose name contains STR
+ *     --baseline=FILE   compare against a previous results.json
+ *     --threshold=PCT   flag regressions slower than PCT percent (default 10)
+ *
+ * Results are written to stdout as JSON; progress and, with --baseline, the
+ * comparison go to stderr. Each benchmark is run once as a warm up (so that
+ * the JITs have settled) and then timed --samples times; the median is the
+ * number to look at. Non-GC benchmarks start each sample with a full GC so
+ * that collections left over from the previous sample don't land in the
+ * timing.
+ *
+ * Complete example usage:
+ *
+ *     $ ./js microbench.js > control.json
+ *
+ *     Next, apply some patch you'd like to test.
+ *
+ *     $ ./js microbench.js --baseline=control.json > variable.json
+ *
+ * The script exits with status 1 if any benchmark regressed by more than the
+ * threshold, so it can be used as a simple gate.
+ */
+
+var gOptions = {
+    samples: 15,
+    filter: "",
+    baseline: null,
+    threshold: 10
+};
+
+for (var arg of scriptArgs) {
+    var m = /^--(\w+)=(.*)$/.exec(arg);
+    if (!m || !(m[1] in gOptions)) {
+        printErr("error: unknown argument '" + arg + "'");
+        quit(2);
+    }
+    gOptions[m[1]] = typeof gOptions[m[1]] == "number" ? Number(m[2]) : m[2];
+}
+
+// Keep results of benchmark bodies alive so that nothing gets optimized away.
+var gSink = null;
+
+// Each benchmark is a function that does a fixed amount of work. A |setup|
+// function, if present, runs untimed before every sample and its result is
+// passed to the body.
+var gBenchmarks = [];
+
+function benchmark(name, body, setup) {
+    gBenchmarks.push({ name: name, body: body, setup: setup });
+}
+
+//=============================================================================
+// GC and allocation
+//=============================================================================
+
+benchmark("alloc-nursery-objects", function() {
+    var obj;
+    for (var i = 0; i < 1000000; i++)
+        obj = { x: i, y: i };
+    gSink = obj;
+});
+
+benchmark("alloc-nursery-arrays", function() {
+    var arr;
+    for (var i = 0; i < 500000; i++)
+        arr = [i, i, i, i];
+    gSink = arr;
+});
+
+benchmark("alloc-tenured-survivors", function() {
+    var list = [];
+    for (var i = 0; i < 300000; i++)
+        list.push({ v: i });
+    gSink = list;
+});
+
+benchmark("gc-minor-full-nursery", function() {
+    minorgc();
+}, function() {
+    var keep = [];
+    for (var i = 0; i < 100000; i++)
+        keep.push({ v: i });
+    return keep;
+});
+
+function buildHeap(objects) {
+    var heap = [];
+    for (var i = 0; i < objects; i++)
+        heap.push({ a: i, b: [i], c: "s" + i });
+    return heap;
+}
+
+for (var heapObjects of [10000, 100000, 1000000]) {
+    benchmark("gc-major-" + heapObjects + "-objects", function() {
+        gc();
+    }, buildHeap.bind(null, heapObjects));
+}
+
+//=============================================================================
+// Property access and inline caches
+//=============================================================================
+
+benchmark("prop-monomorphic", function() {
+    var o = { x: 1, y: 2 };
+    var sum = 0;
+    for (var i = 0; i < 5000000; i++)
+        sum += o.x + o.y;
+    gSink = sum;
+});
+
+benchmark("prop-polymorphic", function() {
+    var shapes = [{ x: 1 }, { a: 0, x: 1 }, { a: 0, b: 0, x: 1 }, { a: 0, b: 0, c: 0, x: 1 }];
+    var sum = 0;
+    for (var i = 0; i < 5000000; i++)
+        sum += shapes[i & 3].x;
+    gSink = sum;
+});
+
+benchmark("prop-megamorphic", function() {
+    var shapes = [];
+    for (var s = 0; s < 32; s++) {
+        var o = {};
+        o["p" + s] = s;
+        o.x = s;
+        shapes.push(o);
+    }
+    var sum = 0;
+    for (var i = 0; i < 2000000; i++)
+        sum += shapes[i & 31].x;
+    gSink = sum;
+});
+
+benchmark("prop-proto-chain", function() {
+    function A() {}
+    A.prototype.f = function() { return 1; };
+    function B() {}
+    B.prototype = new A();
+    function C() {}
+    C.prototype = new B();
+    var c = new C();
+    var sum = 0;
+    for (var i = 0; i < 5000000; i++)
+        sum += c.f();
+    gSink = sum;
+});
+
+//=============================================================================
+// Builtins
+//=============================================================================
+
+benchmark("map-set-get", function() {
+    var map = new Map();
+    for (var i = 0; i < 200000; i++)
+        map.set(i, i);
+    var sum = 0;
+    for (var i = 0; i < 200000; i++)
+        sum += map.get(i);
+    gSink = sum;
+});
+
+benchmark("map-string-keys", function() {
+    var map = new Map();
+    for (var i = 0; i < 100000; i++)
+        map.set("k" + i, i);
+    var sum = 0;
+    for (var i = 0; i < 100000; i++)
+        sum += map.get("k" + i);
+    gSink = sum;
+});
+
+benchmark("set-add-has-delete", function() {
+    var set = new Set();
+    for (var i = 0; i < 200000; i++)
+        set.add(i);
+    var hits = 0;
+    for (var i = 0; i < 400000; i++)
+        hits += set.has(i) ? 1 : 0;
+    for (var i = 0; i < 200000; i += 2)
+        set.delete(i);
+    gSink = hits + set.size;
+});
+
+benchmark("string-concat", function() {
+    var s = "";
+    for (var i = 0; i < 200000; i++)
+        s += "ab" + i;
+    gSink = s.length;
+});
+
+benchmark("string-concat-flatten", function() {
+    var total = 0;
+    for (var i = 0; i < 2000; i++) {
+        var s = "";
+        for (var j = 0; j < 100; j++)
+            s += "xyz";
+        total += s.charCodeAt(s.length - 1);
+    }
+    gSink = total;
+});
+
+var gJSONText = null;
+
+function jsonText() {
+    if (!gJSONText) {
+        var data = [];
+        for (var i = 0; i < 20000; i++)
+            data.push({ id: i, name: "item" + i, tags: ["a", "b"], value: i / 3 });
+        gJSONText = JSON.stringify(data);
+    }
+    return gJSONText;
+}
+
+benchmark("json-parse", function(text) {
+    gSink = JSON.parse(text);
+}, jsonText);
+
+benchmark("json-stringify", function(data) {
+    gSink = JSON.stringify(data);
+}, function() {
+    return JSON.parse(jsonText());
+});
+
+//=============================================================================
+// Driver
+//=============================================================================
+
+function median(values) {
+    var sorted = values.slice().sort(function(a, b) { return a - b; });
+    var mid = sorted.length >> 1;
+    return sorted.length & 1 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+}
+
+function runOne(bench) {
+    var samples = [];
+    for (var i = 0; i <= gOptions.samples; i++) {
+        var input = bench.setup ? bench.setup() : undefined;
+        if (!bench.name.startsWith("gc-"))
+            gc();
+        var start = performance.now();
+        bench.body(input);
+        var elapsed = performance.now() - start;
+        gSink = null;
+        input = null;
+        // The first run is a warm up.
+        if (i > 0)
+            samples.push(elapsed);
+    }
+    return {
+        median: median(samples),
+        min: Math.min.apply(null, samples),
+        max: Math.max.apply(null, samples),
+        samples: samples.length
+    };
+}
+
+var gResults = {};
+for (var bench of gBenchmarks) {
+    if (gOptions.filter && !bench.name.includes(gOptions.filter))
+        continue;
+    printErr("Running " + bench.name);
+    gResults[bench.name] = runOne(bench);
+}
+
+print(JSON.stringify({ unit: "ms", results: gResults }, null, 2));
+
+if (gOptions.baseline) {
+    var baseline = JSON.parse(os.file.readFile(gOptions.baseline)).results;
+    var regressed = false;
+    printErr("");
+    printErr("benchmark                              baseline      current     change");
+    for (var name in gResults) {
+        if (!(name in baseline))
+            continue;
+        var before = baseline[name].median;
+        var after = gResults[name].median;
+        var change = before > 0 ? (after - before) / before * 100 : 0;
+        var flag = "";
+        if (change > gOptions.threshold) {
+            flag = "  REGRESSION";
+            regressed = true;
+        }
+        printErr(name.padEnd(36) +
+                 before.toFixed(3).padStart(12) +
+                 after.toFixed(3).padStart(13) +
+                 ((change >= 0 ? "+" : "") + change.toFixed(1) + "%").padStart(11) +
+                 flag);
+    }
+    if (regressed)
+        quit(1);
+}
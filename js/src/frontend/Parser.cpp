@@ -8509,7 +8509,13 @@ typename ParseHandler::Node
 Parser<ParseHandler, CharT>::unaryOpExpr(YieldHandling yieldHandling, ParseNodeKind kind, JSOp op,
                                          uint32_t begin)
 {
-    Node kid = unaryExpr(yieldHandling, TripledotProhibited);
+    // Minifiers commonly emit immediately-invoked functions as
+    // |!function(){...}()| or |void function(){...}()| instead of wrapping
+    // them in parentheses. Predict these as invoked too, so that they are
+    // compiled eagerly rather than lazily parsed and then delazified on the
+    // first call.
+    Node kid = unaryExpr(yieldHandling, TripledotProhibited, /* possibleError = */ nullptr,
+                         PredictInvoked);
     if (!kid)
         return null();
     return handler.newUnary(kind, op, begin, kid);
@@ -1803,6 +1803,7 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
             }
 
         skipline:
+            userbuf.skipRawCharsWhile([](CharT ch) { return !TokenBuf::isRawEOLChar(ch); });
             do {
                 if (!getChar(&c))
                     goto error;
@@ -1818,6 +1819,10 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
             unsigned linenoBefore = lineno;
 
             do {
+                userbuf.skipRawCharsWhile([](CharT ch) {
+                    return ch != '*' && ch != '@' && ch != '#' && !TokenBuf::isRawEOLChar(ch);
+                });
+
                 if (!getChar(&c))
                     return false;
 
@@ -1983,10 +1988,28 @@ TokenStream::getStringOrTemplateToken(int untilChar, Token** tp)
     *tp = newToken(-1);
     tokenbuf.clear();
 
+    // Chars that need no special handling are copied to tokenbuf in runs
+    // straight from the source buffer.
+    auto isPlainChar = [untilChar, parsingTemplate](CharT ch) {
+        return ch != untilChar && ch != '\\' && !TokenBuf::isRawEOLChar(ch) &&
+               !(parsingTemplate && ch == '$');
+    };
+
     // We need to detect any of these chars:  " or ', \n (or its
     // equivalents), \\, EOF.  Because we detect EOL sequences here and
     // put them back immediately, we can use getCharIgnoreEOL().
-    while ((c = getCharIgnoreEOL()) != untilChar) {
+    while (true) {
+        const CharT* run = userbuf.skipRawCharsWhile(isPlainChar);
+        if (run != userbuf.addressOfNextRawChar() &&
+            !tokenbuf.append(run, userbuf.addressOfNextRawChar()))
+        {
+            ReportOutOfMemory(cx);
+            return false;
+        }
+
+        if ((c = getCharIgnoreEOL()) == untilChar)
+            break;
+
         if (c == EOF) {
             ungetCharIgnoreEOL(c);
             error(JSMSG_UNTERMINATED_STRING);
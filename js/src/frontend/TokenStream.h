@@ -1006,6 +1006,19 @@ class MOZ_STACK_CLASS TokenStream final : public TokenStreamAnyChars
             return ptr;
         }
 
+        // Consume the longest run of raw chars for which |pred| returns true,
+        // stopping at the end of the buffer, and return the start of the run.
+        // This lets callers skip or copy chars that need no special handling
+        // without going through the per-char EOL machinery.
+        template <typename Predicate>
+        const CharT* skipRawCharsWhile(Predicate pred) {
+            MOZ_ASSERT(ptr);     // make sure it hasn't been poisoned
+            const CharT* start = ptr;
+            while (ptr < limit_ && pred(*ptr))
+                ptr++;
+            return start;
+        }
+
         // Use this with caution!
         void setAddressOfNextRawChar(const CharT* a, bool allowPoisoned = false) {
             MOZ_ASSERT_IF(!allowPoisoned, a);
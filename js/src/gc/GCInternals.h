@@ -147,7 +147,7 @@ struct TenureCount
 // of potential collisions.
 struct TenureCountCache
 {
-    static const size_t EntryShift = 4;
+    static const size_t EntryShift = 6;
     static const size_t EntryCount = 1 << EntryShift;
 
     TenureCount entries[EntryCount];
@@ -1080,6 +1080,9 @@ struct Chunk
   private:
     void decommitAllArenas(JSRuntime* rt);
 
+    /* Whether the arena at |index| is free but has not been decommitted. */
+    bool isArenaFreeCommitted(size_t index);
+
     /* Search for a decommitted arena to allocate. */
     unsigned findDecommittedArenaOffset();
     Arena* fetchNextDecommittedArena();
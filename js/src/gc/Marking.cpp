@@ -2858,10 +2858,14 @@ js::Nursery::collectToFixedPoint(TenuringTracer& mover, TenureCountCache& tenure
         JSObject* obj = static_cast<JSObject*>(p->forwardingAddress());
         mover.traceObject(obj);
 
+        // A group that collides with one already in the cache wears down the
+        // occupant's count and takes over the entry if it reaches zero, so
+        // heavily tenured groups are not locked out by whichever group
+        // happened to be tenured first.
         TenureCount& entry = tenureCounts.findEntry(obj->groupRaw());
         if (entry.group == obj->groupRaw()) {
             entry.count++;
-        } else if (!entry.group) {
+        } else if (!entry.group || --entry.count == 0) {
             entry.group = obj->groupRaw();
             entry.count = 1;
         }
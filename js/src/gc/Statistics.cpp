@@ -416,6 +416,7 @@ Statistics::formatDetailedDescription() const
   HeapSize: %.3f MiB\n\
   Chunk Delta (magnitude): %+d  (%d)\n\
   Arenas Relocated: %.3f MiB\n\
+  Functions Relazified: %d\n\
 ";
     char buffer[1024];
     SprintfLiteral(buffer, format,
@@ -433,7 +434,8 @@ Statistics::formatDetailedDescription() const
                    double(preBytes) / bytesPerMiB,
                    getCount(STAT_NEW_CHUNK) - getCount(STAT_DESTROY_CHUNK),
                    getCount(STAT_NEW_CHUNK) + getCount(STAT_DESTROY_CHUNK),
-                   double(ArenaSize * getCount(STAT_ARENA_RELOCATED)) / bytesPerMiB);
+                   double(ArenaSize * getCount(STAT_ARENA_RELOCATED)) / bytesPerMiB,
+                   getCount(STAT_RELAZIFIED_FUNCTIONS));
     return DuplicateString(buffer);
 }
 
@@ -596,6 +598,7 @@ Statistics::formatJsonDescription(uint64_t timestamp, JSONPrinter& json) const
     json.property("total_compartments", zoneStats.compartmentCount);
     json.property("minor_gcs", counts[STAT_MINOR_GC]);
     json.property("store_buffer_overflows", counts[STAT_STOREBUFFER_OVERFLOW]);
+    json.property("relazified_functions", counts[STAT_RELAZIFIED_FUNCTIONS]);
     json.property("slices", slices_.length());
 
     const double mmu20 = computeMMU(TimeDuration::FromMilliseconds(20));
@@ -47,6 +47,9 @@ enum Stat {
     // Number of arenas relocated by compacting GC.
     STAT_ARENA_RELOCATED,
 
+    // Number of functions whose scripts were discarded by relazification.
+    STAT_RELAZIFIED_FUNCTIONS,
+
     STAT_LIMIT
 };
 
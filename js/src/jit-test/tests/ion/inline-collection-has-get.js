@@ -0,0 +1,100 @@
+// Ion inlines Map.prototype.has, Set.prototype.has and Map.prototype.get as
+// MCollectionHas and MMapGet when the receiver is known to be a Map or Set.
+
+setJitCompilerOption("ion.warmup.trigger", 30);
+
+var obj = {};
+var sym = Symbol();
+var keys = [1, 1.5, "str", obj, sym, true, null, undefined, NaN, 0];
+var misses = [2, 2.5, "other", {}, Symbol(), false, "1", "NaN"];
+var nanIndex = 8, zeroIndex = 9;
+
+function mapHas(m, k) {
+    return m.has(k);
+}
+function mapGet(m, k) {
+    return m.get(k);
+}
+function setHas(s, k) {
+    return s.has(k);
+}
+
+var map = new Map(keys.map((k, i) => [k, i]));
+var set = new Set(keys);
+
+for (var i = 0; i < 200; i++) {
+    // Hits.
+    for (var j = 0; j < keys.length; j++) {
+        assertEq(mapHas(map, keys[j]), true);
+        assertEq(mapGet(map, keys[j]), j);
+        assertEq(setHas(set, keys[j]), true);
+    }
+
+    // Misses.
+    for (var k of misses) {
+        assertEq(mapHas(map, k), false);
+        assertEq(mapGet(map, k), undefined);
+        assertEq(setHas(set, k), false);
+    }
+
+    // NaN is found through any NaN, and -0 is the same key as +0.
+    assertEq(mapHas(map, 0 / 0), true);
+    assertEq(mapGet(map, Math.sqrt(-1)), nanIndex);
+    assertEq(setHas(set, -0), true);
+    assertEq(mapHas(map, -0), true);
+    assertEq(mapGet(map, -0), zeroIndex);
+}
+
+// Values of any type come back through the type barrier.
+var mixed = new Map([[1, 1], [2, "two"], [3, obj], [4, 4.5], [5, null]]);
+for (var i = 0; i < 200; i++)
+    assertEq(mapGet(mixed, (i % 5) + 1), [1, "two", obj, 4.5, null][i % 5]);
+
+// Mutations are seen by compiled code.
+map.delete("str");
+set.delete("str");
+map.set("new", 42);
+set.add("new");
+assertEq(mapHas(map, "str"), false);
+assertEq(mapGet(map, "str"), undefined);
+assertEq(setHas(set, "str"), false);
+assertEq(mapGet(map, "new"), 42);
+assertEq(setHas(set, "new"), true);
+
+// Receivers that are not a Map or Set, after the calls were compiled.
+function assertThrowsTypeError(f) {
+    var caught = false;
+    try {
+        f();
+    } catch (e) {
+        caught = e instanceof TypeError;
+    }
+    assertEq(caught, true);
+}
+var fakeMap = { has: () => "has", get: () => "get" };
+var fakeSet = { has: () => "has" };
+assertEq(mapHas(fakeMap, 1), "has");
+assertEq(mapGet(fakeMap, 1), "get");
+assertEq(setHas(fakeSet, 1), "has");
+assertEq(mapHas(set, 1), true);
+assertEq(setHas(map, 1), true);
+
+function mapHasCall(m, k) {
+    return Map.prototype.has.call(m, k);
+}
+function mapGetCall(m, k) {
+    return Map.prototype.get.call(m, k);
+}
+function setHasCall(s, k) {
+    return Set.prototype.has.call(s, k);
+}
+for (var i = 0; i < 200; i++) {
+    assertEq(mapHasCall(map, 1), true);
+    assertEq(mapGetCall(map, 1), 0);
+    assertEq(setHasCall(set, 1), true);
+}
+assertThrowsTypeError(() => mapHasCall(set, 1));
+assertThrowsTypeError(() => mapGetCall(set, 1));
+assertThrowsTypeError(() => setHasCall(map, 1));
+assertThrowsTypeError(() => mapHasCall({}, 1));
+assertThrowsTypeError(() => setHasCall(new WeakSet, 1));
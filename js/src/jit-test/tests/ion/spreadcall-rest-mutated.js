@@ -0,0 +1,105 @@
+// Ion passes a rest array straight to a spread call when
+// JSOP_OPTIMIZE_SPREADCALL says spreading it would yield its dense elements.
+// Make sure arrays that user code mutated or leaked still go through the
+// iteration protocol.
+
+setJitCompilerOption("ion.warmup.trigger", 30);
+
+function collect() {
+    return Array.prototype.slice.call(arguments).join(",");
+}
+
+function spread(...args) {
+    return collect(...args);
+}
+
+// Unmodified rest arrays.
+function plain(...args) {
+    return spread(...args);
+}
+for (var i = 0; i < 200; i++)
+    assertEq(plain(1, 2, i), "1,2," + i);
+
+// Holes read through to the prototype chain when iterating.
+Array.prototype[1] = "proto";
+function withHole(...args) {
+    delete args[1];
+    return collect(...args);
+}
+for (var i = 0; i < 200; i++)
+    assertEq(withHole(1, 2, i), "1,proto," + i);
+delete Array.prototype[1];
+
+function withTrailingHole(...args) {
+    args[4] = "x";
+    return collect(...args);
+}
+for (var i = 0; i < 200; i++)
+    assertEq(withTrailingHole(1, 2, i), "1,2," + i + ",,x");
+
+// A modified length.
+function shortened(...args) {
+    args.length = 1;
+    return collect(...args);
+}
+function lengthened(...args) {
+    args.length = 4;
+    return collect(...args);
+}
+for (var i = 0; i < 200; i++) {
+    assertEq(shortened(i, 2, 3), String(i));
+    assertEq(lengthened(i, 2), i + ",2,,");
+}
+
+// A changed prototype, with and without a different @@iterator.
+var iterProto = {
+    __proto__: Array.prototype,
+    [Symbol.iterator]: function*() { yield "iter"; }
+};
+var plainProto = { __proto__: Array.prototype };
+function otherProto(proto, ...args) {
+    Object.setPrototypeOf(args, proto);
+    return collect(...args);
+}
+for (var i = 0; i < 200; i++) {
+    assertEq(otherProto(iterProto, 1, i), "iter");
+    assertEq(otherProto(plainProto, 1, i), "1," + i);
+}
+
+// An own @@iterator.
+function ownIterator(...args) {
+    args[Symbol.iterator] = function*() { yield args.length; };
+    return collect(...args);
+}
+for (var i = 0; i < 200; i++)
+    assertEq(ownIterator(1, 2, i), "3");
+
+// A rest array that has leaked and is mutated by other code, after the
+// spread site has been compiled.
+var leaked;
+function leak(...args) {
+    leaked = args;
+    mutate();
+    return collect(...args);
+}
+var mutate = function() {};
+for (var i = 0; i < 200; i++)
+    assertEq(leak(1, i), "1," + i);
+mutate = function() {
+    leaked.length = 5;
+    Object.setPrototypeOf(leaked, iterProto);
+};
+assertEq(leak(1, 2), "iter");
+mutate = function() {
+    delete leaked[0];
+};
+assertEq(leak(1, 2), ",2");
+
+// Array.prototype's iteration changed after the spread site was compiled.
+for (var i = 0; i < 200; i++)
+    assertEq(spread(1, i), "1," + i);
+var arrayIter = Array.prototype[Symbol.iterator];
+Array.prototype[Symbol.iterator] = function*() { yield "patched"; };
+assertEq(spread(1, 2), "patched");
+Array.prototype[Symbol.iterator] = arrayIter;
+assertEq(spread(1, 2), "1,2");
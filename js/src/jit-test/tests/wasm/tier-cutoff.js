@@ -0,0 +1,51 @@
+// A module is compiled in tiers (baseline first, Ion in the background) only
+// when its estimated Ion compile time is above wasm.tier-cutoff-ms; otherwise
+// it is compiled once, with Ion. Force each side of the cutoff.
+
+if (!wasmIsSupported())
+    quit();
+
+var bytes = wasmTextToBinary(`(module
+    (func (export "f") (param i32) (result i32)
+        (i32.add (get_local 0) (i32.const 1))))`);
+
+function compile(cutoffMs) {
+    setJitCompilerOption("wasm.tier-cutoff-ms", cutoffMs);
+    var module = new WebAssembly.Module(bytes);
+    assertEq(new WebAssembly.Instance(module).exports.f(41), 42);
+
+    // Asking for the Ion code blocks until any background compilation is done.
+    var ion = wasmExtractCode(module, "ion") !== null;
+    var baseline = wasmExtractCode(module, "baseline") !== null;
+    return { ion, baseline };
+}
+
+// Nothing is slow enough to tier with a very large cutoff, so a module only
+// ever has one tier: Ion's, unless Ion is disabled.
+var once = compile(0x7fffffff);
+assertEq(once.ion !== once.baseline, true);
+
+// Tiering needs a second core (there are four more helper threads than
+// cores) and both compilers.
+var tieringPossible = helperThreadCount() > 5 && wasmDebuggingIsSupported() && once.ion;
+
+// With a cutoff of 0 every module is worth tiering, and ends up with both
+// tiers once the Ion compilation has finished.
+var tiered = compile(0);
+if (tieringPossible) {
+    assertEq(tiered.baseline, true);
+    assertEq(tiered.ion, true);
+}
+
+// A throughput low enough makes even a tiny module too slow for Ion alone:
+// at one byte per millisecond per core, it takes more than a millisecond
+// whenever it is longer than the core count.
+setJitCompilerOption("wasm.ion-bytecodes-per-ms", 1);
+setJitCompilerOption("wasm.tier-cutoff-ms", 1);
+var slow = new WebAssembly.Module(bytes);
+if (tieringPossible && bytes.length > helperThreadCount() - 4)
+    assertEq(wasmExtractCode(slow, "baseline") !== null, true);
+
+// Negative values restore the defaults.
+setJitCompilerOption("wasm.ion-bytecodes-per-ms", -1);
+setJitCompilerOption("wasm.tier-cutoff-ms", -1);
@@ -589,7 +589,14 @@ BacktrackingAllocator::buildLivenessInfo()
 
         // Shorten the front end of ranges for live variables to their point of
         // definition, if found.
+        size_t numVisited = 0;
         for (LInstructionReverseIterator ins = block->rbegin(); ins != block->rend(); ins++) {
+            // Generated code can contain blocks with many thousands of
+            // instructions, so also allow pausing or cancelling from the
+            // middle of a block.
+            if (++numVisited % 1024 == 0 && mir->shouldCancel("Build Liveness Info (inner loop)"))
+                return false;
+
             // Calls may clobber registers, so force a spill and reload around the callsite.
             if (ins->isCall()) {
                 for (AnyRegisterIterator iter(allRegisters_.asLiveSet()); iter.more(); ++iter) {
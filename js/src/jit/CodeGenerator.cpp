@@ -22,6 +22,7 @@
 #include "jsstr.h"
 
 #include "builtin/Eval.h"
+#include "builtin/MapObject.h"
 #include "builtin/RegExp.h"
 #include "builtin/SelfHostingDefines.h"
 #include "builtin/TypedObject.h"
@@ -4749,6 +4750,17 @@ CodeGenerator::visitApplyArrayGeneric(LApplyArrayGeneric* apply)
     emitApplyGeneric(apply);
 }
 
+typedef bool (*OptimizeSpreadCallFn)(JSContext*, HandleValue, bool*);
+static const VMFunction OptimizeSpreadCallInfo =
+    FunctionInfo<OptimizeSpreadCallFn>(OptimizeSpreadCall, "OptimizeSpreadCall");
+
+void
+CodeGenerator::visitOptimizeSpreadCall(LOptimizeSpreadCall* lir)
+{
+    pushArg(ToValue(lir, LOptimizeSpreadCall::Argument));
+    callVM(OptimizeSpreadCallInfo, lir);
+}
+
 void
 CodeGenerator::visitBail(LBail* lir)
 {
@@ -5375,6 +5387,9 @@ CodeGenerator::generateBody()
 #endif
 
     for (size_t i = 0; i < graph.numBlocks(); i++) {
+        if (gen->shouldCancel("Generate Code (block loop)"))
+            return false;
+
         current = graph.getBlock(i);
 
         // Don't emit any code for trivial blocks, containing just a goto. Such
@@ -6750,6 +6765,39 @@ CodeGenerator::visitGetNextEntryForIterator(LGetNextEntryForIterator* lir)
     }
 }
 
+typedef bool (*CollectionHasFn)(JSContext*, HandleObject, HandleValue, bool*);
+static const VMFunction MapHasInfo =
+    FunctionInfo<CollectionHasFn>(MapObject::has, "MapObject::has");
+static const VMFunction SetHasInfo =
+    FunctionInfo<CollectionHasFn>(SetObject::has, "SetObject::has");
+
+void
+CodeGenerator::visitCollectionHas(LCollectionHas* lir)
+{
+    pushArg(ToValue(lir, LCollectionHas::Key));
+    pushArg(ToRegister(lir->collection()));
+
+    if (lir->mir()->mode() == MCollectionHas::Map) {
+        callVM(MapHasInfo, lir);
+    } else {
+        MOZ_ASSERT(lir->mir()->mode() == MCollectionHas::Set);
+        callVM(SetHasInfo, lir);
+    }
+}
+
+typedef bool (*MapGetFn)(JSContext*, HandleObject, HandleValue, MutableHandleValue);
+static const VMFunction MapGetInfo =
+    FunctionInfo<MapGetFn>(MapObject::get, "MapObject::get");
+
+void
+CodeGenerator::visitMapGet(LMapGet* lir)
+{
+    pushArg(ToValue(lir, LMapGet::Key));
+    pushArg(ToRegister(lir->map()));
+
+    callVM(MapGetInfo, lir);
+}
+
 void
 CodeGenerator::visitTypedArrayLength(LTypedArrayLength* lir)
 {
@@ -195,6 +195,7 @@ class CodeGenerator final : public CodeGeneratorSpecific
     void visitApplyArgsGeneric(LApplyArgsGeneric* apply);
     void emitPushArguments(LApplyArrayGeneric* apply, Register extraStackSpace);
     void visitApplyArrayGeneric(LApplyArrayGeneric* apply);
+    void visitOptimizeSpreadCall(LOptimizeSpreadCall* lir);
     void visitBail(LBail* lir);
     void visitUnreachable(LUnreachable* unreachable);
     void visitEncodeSnapshot(LEncodeSnapshot* lir);
@@ -236,6 +237,8 @@ class CodeGenerator final : public CodeGeneratorSpecific
     void visitArrayLength(LArrayLength* lir);
     void visitSetArrayLength(LSetArrayLength* lir);
     void visitGetNextEntryForIterator(LGetNextEntryForIterator* lir);
+    void visitCollectionHas(LCollectionHas* lir);
+    void visitMapGet(LMapGet* lir);
     void visitTypedArrayLength(LTypedArrayLength* lir);
     void visitTypedArrayElements(LTypedArrayElements* lir);
     void visitSetDisjointTypedElements(LSetDisjointTypedElements* lir);
@@ -34,6 +34,9 @@
     _(IntlIsNumberFormat)           \
     _(IntlIsPluralRules)            \
                                     \
+    _(MapGet)                       \
+    _(MapHas)                       \
+                                    \
     _(MathAbs)                      \
     _(MathFloor)                    \
     _(MathCeil)                     \
@@ -94,6 +97,8 @@
     _(ObjectCreate)                 \
     _(ObjectToString)               \
                                     \
+    _(SetHas)                       \
+                                    \
     _(SimdInt32x4)                  \
     _(SimdUint32x4)                 \
     _(SimdInt16x8)                  \
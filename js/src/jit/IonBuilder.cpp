@@ -2340,11 +2340,11 @@ IonBuilder::inspectOpcode(JSOp op)
 
       case JSOP_OPTIMIZE_SPREADCALL:
       {
-        // Assuming optimization isn't available doesn't affect correctness.
-        // TODO: Investigate dynamic checks.
         MDefinition* arr = current->peek(-1);
-        arr->setImplicitlyUsedUnchecked();
-        pushConstant(BooleanValue(false));
+        MOptimizeSpreadCall* ins = MOptimizeSpreadCall::New(alloc(), arr);
+        current->add(ins);
+        current->push(ins);
+        MOZ_TRY(resumeAfter(ins));
         return Ok();
       }
 
@@ -5165,10 +5165,17 @@ IonBuilder::jsop_funapply(uint32_t argc)
 AbortReasonOr<Ok>
 IonBuilder::jsop_spreadcall()
 {
-    // The arguments array is constructed by a JSOP_SPREADCALLARRAY and not
-    // leaked to user. The complications of spread call iterator behaviour are
-    // handled when the user objects are expanded and copied into this hidden
-    // array.
+    // The arguments array is either a fresh array constructed by a
+    // JSOP_SPREADCALLARRAY, with the complications of spread call iterator
+    // behaviour handled when the user objects are expanded and copied into it,
+    // or, when JSOP_OPTIMIZE_SPREADCALL (see MOptimizeSpreadCall) returned
+    // true, the user's own array. js::OptimizeSpreadCall only returns true for
+    // packed ArrayObjects (no holes, length equal to the initialized length)
+    // whose iteration hasn't been changed by their own @@iterator, their
+    // prototype, Array.prototype[@@iterator] or %ArrayIteratorPrototype%.next.
+    // No user code runs between that check and this op, so spreading such an
+    // array would yield exactly its dense elements, which is what MApplyArray
+    // pushes.
 
 #ifdef DEBUG
     // If we know class, ensure it is what we expected
@@ -11027,20 +11034,27 @@ IonBuilder::getPropTryCommonGetter(bool* emitted, MDefinition* obj, PropertyName
         // that case correctly.
         if ((!jitinfo->isAlwaysInSlot && !jitinfo->isLazilyCachedInSlot) ||
             !objTypes->maybeProxy(constraints())) {
-            MInstruction* get;
-            if (jitinfo->isAlwaysInSlot) {
-                // If our object is a singleton and we know the property is
-                // constant (which is true if and only if the get doesn't alias
-                // anything), we can just read the slot here and use that
-                // constant.
-                JSObject* singleton = objTypes->maybeSingleton();
-                if (singleton && jitinfo->aliasSet() == JSJitInfo::AliasNone) {
-                    size_t slot = jitinfo->slotIndex;
+            // If our object is a singleton and we know the property is
+            // constant (which is true if and only if the get doesn't alias
+            // anything), we can just read the slot here and use that
+            // constant. Lazily cached values can only be used once the getter
+            // has run and filled in the slot.
+            JSObject* singleton = objTypes->maybeSingleton();
+            if (singleton && jitinfo->aliasSet() == JSJitInfo::AliasNone &&
+                (jitinfo->isAlwaysInSlot || jitinfo->isLazilyCachedInSlot))
+            {
+                Value v = GetReservedSlot(singleton, jitinfo->slotIndex);
+                if (jitinfo->isAlwaysInSlot ||
+                    (!v.isUndefined() && !(v.isObject() && IsInsideNursery(&v.toObject()))))
+                {
                     *emitted = true;
-                    pushConstant(GetReservedSlot(singleton, slot));
+                    pushConstant(v);
                     return Ok();
                 }
+            }
 
+            MInstruction* get;
+            if (jitinfo->isAlwaysInSlot) {
                 // We can't use MLoadFixedSlot here because it might not have
                 // the right aliasing behavior; we want to alias DOM setters as
                 // needed.
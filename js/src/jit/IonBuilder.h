@@ -703,6 +703,8 @@ class IonBuilder
     // Map and Set intrinsics.
     InliningResult inlineGetNextEntryForIterator(CallInfo& callInfo,
                                                  MGetNextEntryForIterator::Mode mode);
+    InliningResult inlineCollectionHas(CallInfo& callInfo, MCollectionHas::Mode mode);
+    InliningResult inlineMapGet(CallInfo& callInfo);
 
     // ArrayBuffer intrinsics.
     InliningResult inlineArrayBufferByteLength(CallInfo& callInfo);
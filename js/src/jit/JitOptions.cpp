@@ -254,9 +254,28 @@ DefaultJitOptions::DefaultJitOptions()
     SET_DEFAULT(wasmBatchBaselineThreshold, 10000);
     SET_DEFAULT(wasmBatchIonThreshold, 1100);
 
+    // Estimated Ion compilation time, in milliseconds, above which a wasm
+    // module is compiled with baseline first and tiered up to Ion in the
+    // background. 250ms is roughly where the delay before a module can run
+    // becomes noticeable at page load; 0 always tiers when tiering is possible.
+    SET_DEFAULT(wasmTierCutoffMs, 250);
+
+    // Ion's wasm compilation throughput, in bytecode bytes per millisecond on
+    // one helper thread, used to estimate the time above. This is not
+    // measured at runtime, and the default is deliberately low, below what a
+    // desktop core manages: underestimating it only tiers modules that Ion
+    // could have compiled quickly, which is what happened for every module
+    // before the cutoff existed, whereas overestimating it would hold back
+    // the startup of large modules until Ion is done.
+    SET_DEFAULT(wasmIonBytecodesPerMs, 500);
+
     // Determines whether we suppress using signal handlers
     // for interrupting jit-ed code. This is used only for testing.
     SET_DEFAULT(ionInterruptWithoutSignals, false);
+
+    // Ask the OS to back committed JIT code pages with transparent huge
+    // pages where supported, to reduce iTLB misses in JIT-heavy workloads.
+    SET_DEFAULT(hugePagesForCode, false);
 }
 
 bool
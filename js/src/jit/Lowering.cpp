@@ -614,6 +614,14 @@ LIRGenerator::visitApplyArray(MApplyArray* apply)
     assignSafepoint(lir, apply);
 }
 
+void
+LIRGenerator::visitOptimizeSpreadCall(MOptimizeSpreadCall* ins)
+{
+    auto* lir = new(alloc()) LOptimizeSpreadCall(useBoxAtStart(ins->argument()));
+    defineReturn(lir, ins);
+    assignSafepoint(lir, ins);
+}
+
 void
 LIRGenerator::visitBail(MBail* bail)
 {
@@ -2944,6 +2952,25 @@ LIRGenerator::visitGetNextEntryForIterator(MGetNextEntryForIterator* ins)
     assignSafepoint(lir, ins);
 }
 
+void
+LIRGenerator::visitCollectionHas(MCollectionHas* ins)
+{
+    MOZ_ASSERT(ins->collection()->type() == MIRType::Object);
+    auto lir = new(alloc()) LCollectionHas(useRegisterAtStart(ins->collection()),
+                                           useBoxAtStart(ins->key()));
+    defineReturn(lir, ins);
+    assignSafepoint(lir, ins);
+}
+
+void
+LIRGenerator::visitMapGet(MMapGet* ins)
+{
+    MOZ_ASSERT(ins->map()->type() == MIRType::Object);
+    auto lir = new(alloc()) LMapGet(useRegisterAtStart(ins->map()), useBoxAtStart(ins->key()));
+    defineReturn(lir, ins);
+    assignSafepoint(lir, ins);
+}
+
 void
 LIRGenerator::visitTypedArrayLength(MTypedArrayLength* ins)
 {
@@ -107,6 +107,7 @@ class LIRGenerator : public LIRGeneratorSpecific
     void visitCall(MCall* call);
     void visitApplyArgs(MApplyArgs* apply);
     void visitApplyArray(MApplyArray* apply);
+    void visitOptimizeSpreadCall(MOptimizeSpreadCall* ins);
     void visitBail(MBail* bail);
     void visitUnreachable(MUnreachable* unreachable);
     void visitEncodeSnapshot(MEncodeSnapshot* ins);
@@ -215,6 +216,8 @@ class LIRGenerator : public LIRGeneratorSpecific
     void visitArrayLength(MArrayLength* ins);
     void visitSetArrayLength(MSetArrayLength* ins);
     void visitGetNextEntryForIterator(MGetNextEntryForIterator* ins);
+    void visitCollectionHas(MCollectionHas* ins);
+    void visitMapGet(MMapGet* ins);
     void visitTypedArrayLength(MTypedArrayLength* ins);
     void visitTypedArrayElements(MTypedArrayElements* ins);
     void visitSetDisjointTypedElements(MSetDisjointTypedElements* ins);
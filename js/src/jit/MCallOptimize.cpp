@@ -125,6 +125,12 @@ IonBuilder::inlineNativeCall(CallInfo& callInfo, JSFunction* target)
       case InlinableNative::IntlIsPluralRules:
         return inlineHasClass(callInfo, &PluralRulesObject::class_);
 
+      // Map natives.
+      case InlinableNative::MapGet:
+        return inlineMapGet(callInfo);
+      case InlinableNative::MapHas:
+        return inlineCollectionHas(callInfo, MCollectionHas::Map);
+
       // Math natives.
       case InlinableNative::MathAbs:
         return inlineMathAbs(callInfo);
@@ -247,6 +253,10 @@ IonBuilder::inlineNativeCall(CallInfo& callInfo, JSFunction* target)
       case InlinableNative::ObjectToString:
         return inlineObjectToString(callInfo);
 
+      // Set natives.
+      case InlinableNative::SetHas:
+        return inlineCollectionHas(callInfo, MCollectionHas::Set);
+
       // SIMD natives.
       case InlinableNative::SimdInt32x4:
         return inlineSimd(callInfo, target, SimdType::Int32x4);
@@ -2514,6 +2524,75 @@ IonBuilder::inlineGetNextEntryForIterator(CallInfo& callInfo, MGetNextEntryForIt
     return InliningStatus_Inlined;
 }
 
+IonBuilder::InliningResult
+IonBuilder::inlineCollectionHas(CallInfo& callInfo, MCollectionHas::Mode mode)
+{
+    if (callInfo.argc() != 1 || callInfo.constructing()) {
+        trackOptimizationOutcome(TrackedOutcome::CantInlineNativeBadForm);
+        return InliningStatus_NotInlined;
+    }
+
+    if (getInlineReturnType() != MIRType::Boolean)
+        return InliningStatus_NotInlined;
+
+    MDefinition* obj = callInfo.thisArg();
+    if (obj->type() != MIRType::Object)
+        return InliningStatus_NotInlined;
+
+    TemporaryTypeSet* thisTypes = obj->resultTypeSet();
+    const Class* clasp = thisTypes ? thisTypes->getKnownClass(constraints()) : nullptr;
+    if (mode == MCollectionHas::Map) {
+        if (clasp != &MapObject::class_)
+            return InliningStatus_NotInlined;
+    } else {
+        MOZ_ASSERT(mode == MCollectionHas::Set);
+
+        if (clasp != &SetObject::class_)
+            return InliningStatus_NotInlined;
+    }
+
+    callInfo.setImplicitlyUsedUnchecked();
+
+    // Call the lookup directly, skipping the native call and the
+    // CallNonGenericMethod dispatch, and with a known boolean result.
+    MCollectionHas* has = MCollectionHas::New(alloc(), obj, callInfo.getArg(0), mode);
+    current->add(has);
+    current->push(has);
+
+    MOZ_TRY(resumeAfter(has));
+    return InliningStatus_Inlined;
+}
+
+IonBuilder::InliningResult
+IonBuilder::inlineMapGet(CallInfo& callInfo)
+{
+    if (callInfo.argc() != 1 || callInfo.constructing()) {
+        trackOptimizationOutcome(TrackedOutcome::CantInlineNativeBadForm);
+        return InliningStatus_NotInlined;
+    }
+
+    MDefinition* obj = callInfo.thisArg();
+    if (obj->type() != MIRType::Object)
+        return InliningStatus_NotInlined;
+
+    TemporaryTypeSet* thisTypes = obj->resultTypeSet();
+    const Class* clasp = thisTypes ? thisTypes->getKnownClass(constraints()) : nullptr;
+    if (clasp != &MapObject::class_)
+        return InliningStatus_NotInlined;
+
+    callInfo.setImplicitlyUsedUnchecked();
+
+    // As for has, call the lookup directly. The value can be anything the map
+    // holds, so it goes through the call site's observed types.
+    MMapGet* get = MMapGet::New(alloc(), obj, callInfo.getArg(0));
+    current->add(get);
+    current->push(get);
+
+    MOZ_TRY(resumeAfter(get));
+    MOZ_TRY(pushTypeBarrier(get, getInlineReturnTypeSet(), BarrierKind::TypeSet));
+    return InliningStatus_Inlined;
+}
+
 static bool
 IsArrayBufferObject(CompilerConstraintList* constraints, MDefinition* def)
 {
@@ -4416,6 +4416,28 @@ class MApplyArray
     }
 };
 
+// Whether the argument of a spread call can be passed to the call as is,
+// without spreading it into a new array. See js::OptimizeSpreadCall.
+class MOptimizeSpreadCall
+  : public MUnaryInstruction,
+    public BoxInputsPolicy::Data
+{
+    explicit MOptimizeSpreadCall(MDefinition* argument)
+      : MUnaryInstruction(classOpcode, argument)
+    {
+        setResultType(MIRType::Boolean);
+    }
+
+  public:
+    INSTRUCTION_HEADER(OptimizeSpreadCall)
+    TRIVIAL_NEW_WRAPPERS
+    NAMED_OPERANDS((0, argument))
+
+    bool possiblyCalls() const override {
+        return true;
+    }
+};
+
 class MBail : public MNullaryInstruction
 {
   protected:
@@ -9257,6 +9279,60 @@ class MGetNextEntryForIterator
     }
 };
 
+// Map.prototype.has or Set.prototype.has on an object known to be a Map or Set.
+class MCollectionHas
+  : public MBinaryInstruction,
+    public MixPolicy<ObjectPolicy<0>, BoxPolicy<1> >::Data
+{
+  public:
+    enum Mode {
+        Map,
+        Set
+    };
+
+  private:
+    Mode mode_;
+
+    MCollectionHas(MDefinition* collection, MDefinition* key, Mode mode)
+      : MBinaryInstruction(classOpcode, collection, key), mode_(mode)
+    {
+        setResultType(MIRType::Boolean);
+    }
+
+  public:
+    INSTRUCTION_HEADER(CollectionHas)
+    TRIVIAL_NEW_WRAPPERS
+    NAMED_OPERANDS((0, collection), (1, key))
+
+    Mode mode() const {
+        return mode_;
+    }
+    bool possiblyCalls() const override {
+        return true;
+    }
+};
+
+// Map.prototype.get on an object known to be a Map.
+class MMapGet
+  : public MBinaryInstruction,
+    public MixPolicy<ObjectPolicy<0>, BoxPolicy<1> >::Data
+{
+    MMapGet(MDefinition* map, MDefinition* key)
+      : MBinaryInstruction(classOpcode, map, key)
+    {
+        setResultType(MIRType::Value);
+    }
+
+  public:
+    INSTRUCTION_HEADER(MapGet)
+    TRIVIAL_NEW_WRAPPERS
+    NAMED_OPERANDS((0, map), (1, key))
+
+    bool possiblyCalls() const override {
+        return true;
+    }
+};
+
 // Read the length of a typed array.
 class MTypedArrayLength
   : public MUnaryInstruction,
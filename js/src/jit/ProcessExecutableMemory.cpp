@@ -11,6 +11,7 @@
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Maybe.h"
 #include "mozilla/TaggedAnonymousMemory.h"
+#include "mozilla/Unused.h"
 #include "mozilla/XorShift128PlusRNG.h"
 
 #include "jsfriendapi.h"
@@ -21,6 +22,7 @@
 #include <errno.h>
 
 #include "gc/Memory.h"
+#include "jit/JitOptions.h"
 #include "threading/LockGuard.h"
 #include "threading/Mutex.h"
 #include "vm/MutexIDs.h"
@@ -337,6 +339,13 @@ CommitPages(void* addr, size_t bytes, ProtectionSetting protection)
                                      MAP_FIXED | MAP_PRIVATE | MAP_ANON,
                                      -1, 0, "js-executable-memory");
     MOZ_RELEASE_ASSERT(addr == p);
+
+#ifdef MADV_HUGEPAGE
+    // This is only a hint, so ignore failures (e.g. when transparent huge
+    // pages are disabled system-wide).
+    if (JitOptions.hugePagesForCode)
+        mozilla::Unused << madvise(addr, bytes, MADV_HUGEPAGE);
+#endif
 }
 
 static void
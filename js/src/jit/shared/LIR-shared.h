@@ -2252,6 +2252,18 @@ class LApplyArrayGeneric : public LCallInstructionHelper<BOX_PIECES, BOX_PIECES
     }
 };
 
+class LOptimizeSpreadCall : public LCallInstructionHelper<1, BOX_PIECES, 0>
+{
+  public:
+    LIR_HEADER(OptimizeSpreadCall)
+
+    static const size_t Argument = 0;
+
+    explicit LOptimizeSpreadCall(const LBoxAllocation& argument) {
+        setBoxOperand(Argument, argument);
+    }
+};
+
 class LGetDynamicName : public LCallInstructionHelper<BOX_PIECES, 2, 3>
 {
   public:
@@ -5408,6 +5420,41 @@ class LGetNextEntryForIterator : public LInstructionHelper<1, 2, 3>
     }
 };
 
+class LCollectionHas : public LCallInstructionHelper<1, 1 + BOX_PIECES, 0>
+{
+  public:
+    LIR_HEADER(CollectionHas)
+
+    static const size_t Key = 1;
+
+    LCollectionHas(const LAllocation& collection, const LBoxAllocation& key) {
+        setOperand(0, collection);
+        setBoxOperand(Key, key);
+    }
+    const LAllocation* collection() {
+        return getOperand(0);
+    }
+    const MCollectionHas* mir() const {
+        return mir_->toCollectionHas();
+    }
+};
+
+class LMapGet : public LCallInstructionHelper<BOX_PIECES, 1 + BOX_PIECES, 0>
+{
+  public:
+    LIR_HEADER(MapGet)
+
+    static const size_t Key = 1;
+
+    LMapGet(const LAllocation& map, const LBoxAllocation& key) {
+        setOperand(0, map);
+        setBoxOperand(Key, key);
+    }
+    const LAllocation* map() {
+        return getOperand(0);
+    }
+};
+
 // Read the length of a typed array.
 class LTypedArrayLength : public LInstructionHelper<1, 1, 0>
 {
@@ -90,6 +90,7 @@
     _(CallNative)                   \
     _(ApplyArgsGeneric)             \
     _(ApplyArrayGeneric)            \
+    _(OptimizeSpreadCall)           \
     _(Bail)                         \
     _(Unreachable)                  \
     _(EncodeSnapshot)               \
@@ -350,6 +351,8 @@
     _(ArrayLength)                  \
     _(SetArrayLength)               \
     _(GetNextEntryForIterator)      \
+    _(CollectionHas)                \
+    _(MapGet)                       \
     _(TypedArrayLength)             \
     _(TypedArrayElements)           \
     _(SetDisjointTypedElements)     \
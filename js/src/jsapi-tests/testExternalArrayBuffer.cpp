@@ -3,6 +3,7 @@
  */
 
 #include "jsfriendapi.h"
+#include "js/StructuredClone.h"
 #include "jsapi-tests/tests.h"
 #include "vm/ArrayBufferObject.h"
 
@@ -46,3 +47,178 @@ bool VerifyObject(JS::HandleObject obj, uint32_t length)
 }
 
 END_TEST(testExternalArrayBuffer)
+
+// Counts calls to the free function. The count is kept outside of the tests'
+// stack frames, because a test that fails early leaves its buffer to be
+// finalized later.
+static unsigned externalFreeCount = 0;
+
+struct ExternalContents
+{
+    static const size_t Length = 16;
+
+    uint8_t* data;
+
+    ExternalContents() : data(static_cast<uint8_t*>(js_malloc(Length))) {
+        externalFreeCount = 0;
+        for (size_t i = 0; i < Length; i++)
+            data[i] = uint8_t(i);
+    }
+
+    // The contents are passed as their own user data, to check that both
+    // arrive intact.
+    static void Free(void* contents, void* userData) {
+        MOZ_RELEASE_ASSERT(contents == userData);
+        externalFreeCount++;
+        js_free(contents);
+    }
+};
+
+static bool
+HasExternalContents(JSObject* obj, size_t length)
+{
+    JS::AutoCheckCannotGC nogc;
+    if (!JS_IsArrayBufferObject(obj) || JS_GetArrayBufferByteLength(obj) != length)
+        return false;
+    bool isShared;
+    const uint8_t* data = JS_GetArrayBufferData(obj, &isShared, nogc);
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != uint8_t(i))
+            return false;
+    }
+    return true;
+}
+
+BEGIN_TEST(testExternalArrayBuffer_finalize)
+{
+    ExternalContents contents;
+    JS::RootedObject obj(cx, JS_NewExternalArrayBuffer(cx, ExternalContents::Length,
+                                                       contents.data, ExternalContents::Free,
+                                                       contents.data));
+    CHECK(obj);
+    CHECK(HasExternalContents(obj, ExternalContents::Length));
+
+    // The contents stay alive while the buffer is.
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 0u);
+    CHECK(HasExternalContents(obj, ExternalContents::Length));
+
+    obj = nullptr;
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 1u);
+
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 1u);
+
+    return true;
+}
+END_TEST(testExternalArrayBuffer_finalize)
+
+BEGIN_TEST(testExternalArrayBuffer_detach)
+{
+    ExternalContents contents;
+    JS::RootedObject obj(cx, JS_NewExternalArrayBuffer(cx, ExternalContents::Length,
+                                                       contents.data, ExternalContents::Free,
+                                                       contents.data));
+    CHECK(obj);
+
+    // Detaching releases the contents right away, and finalizing the
+    // detached buffer doesn't release them again.
+    CHECK(JS_DetachArrayBuffer(cx, obj));
+    CHECK(JS_IsDetachedArrayBufferObject(obj));
+    CHECK_EQUAL(externalFreeCount, 1u);
+    CHECK_EQUAL(JS_GetArrayBufferByteLength(obj), 0u);
+
+    obj = nullptr;
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 1u);
+
+    return true;
+}
+END_TEST(testExternalArrayBuffer_detach)
+
+BEGIN_TEST(testExternalArrayBuffer_clone)
+{
+    ExternalContents contents;
+    JS::RootedObject obj(cx, JS_NewExternalArrayBuffer(cx, ExternalContents::Length,
+                                                       contents.data, ExternalContents::Free,
+                                                       contents.data));
+    CHECK(obj);
+    JS::RootedValue v1(cx, JS::ObjectValue(*obj));
+
+    // Cloning copies the data and leaves the original alone.
+    JS::RootedValue v2(cx);
+    CHECK(JS_StructuredClone(cx, v1, &v2, nullptr, nullptr));
+    CHECK(v2.isObject());
+    CHECK(&v2.toObject() != obj);
+    CHECK(HasExternalContents(&v2.toObject(), ExternalContents::Length));
+    CHECK(HasExternalContents(obj, ExternalContents::Length));
+    CHECK_EQUAL(externalFreeCount, 0u);
+
+    // Transferring copies too, since external contents can't be stolen, and
+    // detaches the original.
+    JS::AutoValueVector argv(cx);
+    CHECK(argv.append(v1));
+    JS::RootedObject transferList(cx, JS_NewArrayObject(cx, JS::HandleValueArray::subarray(argv, 0, 1)));
+    CHECK(transferList);
+    JS::RootedValue transferable(cx, JS::ObjectValue(*transferList));
+
+    JSAutoStructuredCloneBuffer clonedBuffer(JS::StructuredCloneScope::SameProcessSameThread,
+                                             nullptr, nullptr);
+    CHECK(clonedBuffer.write(cx, v1, transferable, JS::CloneDataPolicy().denySharedArrayBuffer(),
+                             nullptr, nullptr));
+    JS::RootedValue v3(cx);
+    CHECK(clonedBuffer.read(cx, &v3, nullptr, nullptr));
+    CHECK(v3.isObject());
+    CHECK(HasExternalContents(&v3.toObject(), ExternalContents::Length));
+    CHECK(JS_IsDetachedArrayBufferObject(obj));
+
+    // Whatever happened to the original, its contents are released once.
+    obj = nullptr;
+    v1.setUndefined();
+    argv.clear();
+    transferList = nullptr;
+    transferable.setUndefined();
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 1u);
+
+    // The copies own plain memory and don't call back.
+    v2.setUndefined();
+    v3.setUndefined();
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 1u);
+
+    return true;
+}
+END_TEST(testExternalArrayBuffer_clone)
+
+BEGIN_TEST(testExternalArrayBuffer_failure)
+{
+    ExternalContents contents;
+
+    // A buffer that is too large is refused, and the contents are left to the
+    // caller without calling the free function.
+    size_t tooLarge = size_t(INT32_MAX) + 1;
+    JS::RootedObject obj(cx, JS_NewExternalArrayBuffer(cx, tooLarge, contents.data,
+                                                       ExternalContents::Free, contents.data));
+    CHECK(!obj);
+    CHECK(JS_IsExceptionPending(cx));
+    JS_ClearPendingException(cx);
+
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 0u);
+    for (size_t i = 0; i < ExternalContents::Length; i++)
+        CHECK_EQUAL(contents.data[i], uint8_t(i));
+
+    // The caller can still hand them to a buffer that succeeds.
+    obj = JS_NewExternalArrayBuffer(cx, ExternalContents::Length, contents.data,
+                                    ExternalContents::Free, contents.data);
+    CHECK(obj);
+    CHECK(HasExternalContents(obj, ExternalContents::Length));
+    obj = nullptr;
+    GC(cx);
+    CHECK_EQUAL(externalFreeCount, 1u);
+
+    return true;
+}
+END_TEST(testExternalArrayBuffer_failure)
@@ -0,0 +1,80 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+ * vim: set ts=8 sts=4 et sw=4 tw=99:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsfun.h"
+
+#include "jsapi-tests/tests.h"
+
+BEGIN_TEST(testGCColdRelazification)
+{
+#ifdef JS_GC_ZEAL
+    // Zeal modes turn GCs into other kinds of GC.
+    JS_SetGCZeal(cx, 0, 0);
+#endif
+
+    JS::CompartmentOptions options;
+    JS::RootedObject coldGlobal(cx, JS_NewGlobalObject(cx, getGlobalClass(), nullptr,
+                                                       JS::FireOnNewGlobalHook, options));
+    CHECK(coldGlobal);
+
+    JS::RootedFunction fun(cx);
+    {
+        JSAutoCompartment ac(cx, coldGlobal);
+        CHECK(JS_InitStandardClasses(cx, coldGlobal));
+
+        JS::RootedValue v(cx);
+        EVAL("function add(a, b) { return a + b; }\n"
+             "add;", &v);
+        CHECK(v.isObject());
+        fun = &v.toObject().as<JSFunction>();
+        CHECK(callAdd(coldGlobal, fun, 40, 2));
+        CHECK(fun->hasScript());
+    }
+
+    // The compartment isn't entered any more. Once it has been cold for a few
+    // GCs, and its type information has been released, ordinary GCs will
+    // relazify its functions.
+    for (unsigned i = 0; i < 50 && !fun->isInterpretedLazy(); i++)
+        collect();
+    CHECK(fun->isInterpretedLazy());
+
+    // The function still works, and gets its script back.
+    {
+        JSAutoCompartment ac(cx, coldGlobal);
+        CHECK(callAdd(coldGlobal, fun, 1, 2));
+        CHECK(fun->hasScript());
+    }
+
+    // Entering the compartment made it hot again, so the next GCs leave it
+    // alone.
+    collect();
+    CHECK(fun->hasScript());
+
+    return true;
+}
+
+bool
+callAdd(JS::HandleObject global, JS::HandleFunction fun, int32_t a, int32_t b)
+{
+    JS::AutoValueArray<2> args(cx);
+    args[0].setInt32(a);
+    args[1].setInt32(b);
+
+    JS::RootedValue rval(cx);
+    CHECK(JS_CallFunction(cx, global, fun, args, &rval));
+    CHECK(rval.isInt32());
+    CHECK_EQUAL(rval.toInt32(), a + b);
+    return true;
+}
+
+void
+collect()
+{
+    JS::PrepareForFullGC(cx);
+    JS::GCForReason(cx, GC_NORMAL, JS::gcreason::API);
+}
+END_TEST(testGCColdRelazification)
@@ -2,7 +2,11 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include "jscompartment.h"
+
+#include "gc/Zone.h"
 #include "jsapi-tests/tests.h"
+#include "vm/RegExpShared.h"
 
 BEGIN_TEST(testObjectIsRegExp)
 {
@@ -58,3 +62,62 @@ BEGIN_TEST(testGetRegExpSource)
     return true;
 }
 END_TEST(testGetRegExpSource)
+
+BEGIN_TEST(testRecentRegExpShareds)
+{
+#ifdef JS_GC_ZEAL
+    // Zeal modes turn GCs into other kinds of GC.
+    JS_SetGCZeal(cx, 0, 0);
+#endif
+
+    js::RegExpZone& zoneRegExps = cx->zone()->regExps;
+    js::RegExpCompartment& compartmentRegExps = cx->compartment()->regExps;
+
+    shrinkingGC();
+    CHECK(zoneRegExps.empty());
+    CHECK(!compartmentRegExps.hasRecentRegExpShareds());
+
+    JS::RootedAtom source(cx, js::Atomize(cx, "ab+c", 4));
+    CHECK(source);
+
+    // Nothing refers to the RegExpShared but the cache of recently used ones.
+    // Only its address is kept here, as holding the pointer across a GC would
+    // root it.
+    js::RegExpShared* shared = zoneRegExps.get(cx, source, js::NoFlags);
+    CHECK(shared);
+    uintptr_t sharedAddr = uintptr_t(shared);
+    CHECK(compartmentRegExps.hasRecentRegExpShareds());
+
+    // An ordinary GC keeps it alive and valid, then empties the cache.
+    JS_GC(cx);
+    CHECK(!compartmentRegExps.hasRecentRegExpShareds());
+    CHECK(!zoneRegExps.empty());
+    shared = zoneRegExps.get(cx, source, js::NoFlags);
+    CHECK(uintptr_t(shared) == sharedAddr);
+    CHECK(shared->getSource() == source);
+    CHECK(shared->getFlags() == js::NoFlags);
+
+    // Having been looked up again, it survives the next GC too.
+    JS_GC(cx);
+    CHECK(!zoneRegExps.empty());
+
+    // A GC that isn't preceded by a lookup collects it.
+    JS_GC(cx);
+    CHECK(zoneRegExps.empty());
+
+    // Shrinking GCs don't keep cached patterns alive at all.
+    CHECK(zoneRegExps.get(cx, source, js::NoFlags));
+    CHECK(compartmentRegExps.hasRecentRegExpShareds());
+    shrinkingGC();
+    CHECK(!compartmentRegExps.hasRecentRegExpShareds());
+    CHECK(zoneRegExps.empty());
+
+    return true;
+}
+
+void shrinkingGC()
+{
+    JS::PrepareForFullGC(cx);
+    JS::GCForReason(cx, GC_SHRINK, JS::gcreason::API);
+}
+END_TEST(testRecentRegExpShareds)
@@ -0,0 +1,90 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "mozilla/Vector.h"
+
+#include "jsapi-tests/tests.h"
+
+#include "wasm/WasmJS.h"
+
+static bool
+GetWasmDeserializeBuildId(JS::BuildIdCharVector* buildId)
+{
+    const char buildid[] = "testWasmDeserialize";
+    return buildId->append(buildid, sizeof(buildid));
+}
+
+BEGIN_TEST(testWasmDeserialize_buffers)
+{
+    if (!js::wasm::HasCompilerSupport(cx))
+        return true;
+
+    JS::SetBuildIdOp(cx, GetWasmDeserializeBuildId);
+
+    // (module (func (export "f") (result i32) (i32.const 42)))
+    JS::RootedValue v(cx);
+    EVAL("new WebAssembly.Module(new Uint8Array(["
+         "0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,"
+         "0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,"
+         "0x03, 0x02, 0x01, 0x00,"
+         "0x07, 0x05, 0x01, 0x01, 0x66, 0x00, 0x00,"
+         "0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x2a, 0x0b]))", &v);
+    CHECK(v.isObject());
+    JS::RootedObject moduleObj(cx, &v.toObject());
+    CHECK(JS::IsWasmModuleObject(moduleObj));
+
+    RefPtr<JS::WasmModule> module = JS::GetWasmModule(moduleObj);
+    CHECK(module);
+
+    mozilla::Vector<uint8_t> bytecode;
+    CHECK(bytecode.resize(module->bytecodeSerializedSize()));
+    module->bytecodeSerialize(bytecode.begin(), bytecode.length());
+
+    // A module this small is compiled with Ion right away, so there is
+    // compiled code to serialize.
+    mozilla::Vector<uint8_t> compiled;
+    CHECK(compiled.resize(module->compiledSerializedSize()));
+    CHECK(compiled.length() > 0);
+    module->compiledSerialize(compiled.begin(), compiled.length());
+
+    // Matching assumptions: the compiled code is used as is.
+    CHECK(Deserialize(bytecode, compiled.begin(), compiled.length(), "testWasmDeserialize"));
+
+    // A different build: the compiled code is ignored and the module is
+    // recompiled from the bytecode.
+    CHECK(Deserialize(bytecode, compiled.begin(), compiled.length(), "someOtherBuild"));
+
+    // No compiled code at all.
+    CHECK(Deserialize(bytecode, nullptr, 0, "testWasmDeserialize"));
+
+    return true;
+}
+
+bool
+Deserialize(const mozilla::Vector<uint8_t>& bytecode, const uint8_t* compiled,
+            size_t compiledSize, const char* buildIdString)
+{
+    JS::BuildIdCharVector buildId;
+    CHECK(buildId.append(buildIdString, strlen(buildIdString) + 1));
+
+    JS::UniqueChars filename(JS_strdup(cx, "testWasmDeserialize.cpp"));
+    CHECK(filename);
+
+    RefPtr<JS::WasmModule> module =
+        JS::DeserializeWasmModule(bytecode.begin(), bytecode.length(), compiled, compiledSize,
+                                  mozilla::Move(buildId), mozilla::Move(filename), 1, 0);
+    CHECK(module);
+
+    JS::RootedObject moduleObj(cx, module->createObject(cx));
+    CHECK(moduleObj);
+    CHECK(JS_DefineProperty(cx, global, "deserialized", moduleObj, 0));
+
+    JS::RootedValue rval(cx);
+    EVAL("new WebAssembly.Instance(deserialized).exports.f()", &rval);
+    CHECK(rval.isInt32());
+    CHECK_EQUAL(rval.toInt32(), 42);
+
+    return true;
+}
+END_TEST(testWasmDeserialize_buffers)
@@ -6230,6 +6230,14 @@ JS_ParseJSON(JSContext* cx, const char16_t* chars, uint32_t len, MutableHandleVa
     return ParseJSONWithReviver(cx, mozilla::Range<const char16_t>(chars, len), NullHandleValue, vp);
 }
 
+JS_PUBLIC_API(bool)
+JS_ParseJSON(JSContext* cx, const JS::Latin1Char* chars, uint32_t len, MutableHandleValue vp)
+{
+    AssertHeapIsIdle();
+    CHECK_REQUEST(cx);
+    return ParseJSONWithReviver(cx, mozilla::Range<const JS::Latin1Char>(chars, len), NullHandleValue, vp);
+}
+
 JS_PUBLIC_API(bool)
 JS_ParseJSON(JSContext* cx, HandleString str, MutableHandleValue vp)
 {
@@ -7163,6 +7171,20 @@ JS_SetGlobalJitCompilerOption(JSContext* cx, JSJitCompilerOption opt, uint32_t v
       case JSJITCOMPILER_WASM_FOLD_OFFSETS:
         jit::JitOptions.wasmFoldOffsets = !!value;
         break;
+      case JSJITCOMPILER_WASM_TIER_CUTOFF:
+        if (value == uint32_t(-1)) {
+            jit::DefaultJitOptions defaultValues;
+            value = defaultValues.wasmTierCutoffMs;
+        }
+        jit::JitOptions.wasmTierCutoffMs = value;
+        break;
+      case JSJITCOMPILER_WASM_ION_BYTECODES_PER_MS:
+        if (value == uint32_t(-1) || value == 0) {
+            jit::DefaultJitOptions defaultValues;
+            value = defaultValues.wasmIonBytecodesPerMs;
+        }
+        jit::JitOptions.wasmIonBytecodesPerMs = value;
+        break;
       case JSJITCOMPILER_ION_INTERRUPT_WITHOUT_SIGNAL:
         jit::JitOptions.ionInterruptWithoutSignals = !!value;
         break;
@@ -7215,6 +7237,12 @@ JS_GetGlobalJitCompilerOption(JSContext* cx, JSJitCompilerOption opt, uint32_t*
       case JSJITCOMPILER_WASM_FOLD_OFFSETS:
         *valueOut = jit::JitOptions.wasmFoldOffsets ? 1 : 0;
         break;
+      case JSJITCOMPILER_WASM_TIER_CUTOFF:
+        *valueOut = jit::JitOptions.wasmTierCutoffMs;
+        break;
+      case JSJITCOMPILER_WASM_ION_BYTECODES_PER_MS:
+        *valueOut = jit::JitOptions.wasmIonBytecodesPerMs;
+        break;
       case JSJITCOMPILER_ION_INTERRUPT_WITHOUT_SIGNAL:
         *valueOut = jit::JitOptions.ionInterruptWithoutSignals ? 1 : 0;
         break;
@@ -7604,6 +7632,16 @@ JS::DeserializeWasmModule(PRFileDesc* bytecode, PRFileDesc* maybeCompiled,
     return wasm::DeserializeModule(bytecode, maybeCompiled, Move(buildId), Move(file), line, column);
 }
 
+JS_PUBLIC_API(RefPtr<JS::WasmModule>)
+JS::DeserializeWasmModule(const uint8_t* bytecode, size_t bytecodeSize,
+                          const uint8_t* maybeCompiled, size_t compiledSize,
+                          JS::BuildIdCharVector&& buildId, UniqueChars file,
+                          unsigned line, unsigned column)
+{
+    return wasm::DeserializeModule(bytecode, bytecodeSize, maybeCompiled, compiledSize,
+                                   Move(buildId), Move(file), line, column);
+}
+
 JS_PUBLIC_API(void)
 JS::SetProcessLargeAllocationFailureCallback(JS::LargeAllocationFailureCallback lafc)
 {
@@ -3716,6 +3716,26 @@ JS_SetAllNonReservedSlotsToUndefined(JSContext* cx, JSObject* objArg);
 extern JS_PUBLIC_API(JSObject*)
 JS_NewArrayBufferWithContents(JSContext* cx, size_t nbytes, void* contents);
 
+namespace JS {
+
+using BufferContentsFreeFunc = void (*)(void* contents, void* userData);
+
+} /* namespace JS */
+
+/**
+ * Create a new array buffer with the given contents. The array buffer takes
+ * ownership of contents and releases them by calling freeFunc(contents,
+ * freeUserData) when it is detached or finalized. This lets embedders wrap
+ * memory that is not malloc'd, such as shared memory segments, without
+ * copying it. Transferring such a buffer copies its data.
+ *
+ * If creation fails, nullptr is returned and freeFunc is not called: the
+ * caller keeps ownership of contents and must release them itself.
+ */
+extern JS_PUBLIC_API(JSObject*)
+JS_NewExternalArrayBuffer(JSContext* cx, size_t nbytes, void* contents,
+                          JS::BufferContentsFreeFunc freeFunc, void* freeUserData = nullptr);
+
 /**
  * Create a new array buffer with the given contents.  The array buffer does not take ownership of
  * contents, and JS_DetachArrayBuffer must be called before the contents are disposed of.
@@ -5482,6 +5502,9 @@ ToJSONMaybeSafely(JSContext* cx, JS::HandleObject input,
 JS_PUBLIC_API(bool)
 JS_ParseJSON(JSContext* cx, const char16_t* chars, uint32_t len, JS::MutableHandleValue vp);
 
+JS_PUBLIC_API(bool)
+JS_ParseJSON(JSContext* cx, const JS::Latin1Char* chars, uint32_t len, JS::MutableHandleValue vp);
+
 JS_PUBLIC_API(bool)
 JS_ParseJSON(JSContext* cx, JS::HandleString str, JS::MutableHandleValue vp);
 
@@ -6205,7 +6228,9 @@ JS_SetOffthreadIonCompilationEnabled(JSContext* cx, bool enabled);
     Register(SIMULATOR_ALWAYS_INTERRUPT, "simulator.always-interrupt")      \
     Register(ASMJS_ATOMICS_ENABLE, "asmjs.atomics.enable")                  \
     Register(WASM_TEST_MODE, "wasm.test-mode")                              \
-    Register(WASM_FOLD_OFFSETS, "wasm.fold-offsets")
+    Register(WASM_FOLD_OFFSETS, "wasm.fold-offsets")                        \
+    Register(WASM_TIER_CUTOFF, "wasm.tier-cutoff-ms")                       \
+    Register(WASM_ION_BYTECODES_PER_MS, "wasm.ion-bytecodes-per-ms")
 
 typedef enum JSJitCompilerOption {
 #define JIT_COMPILER_DECLARE(key, str) \
@@ -6543,6 +6568,11 @@ SetBuildIdOp(JSContext* cx, BuildIdOp buildIdOp);
  * The JS::WasmObject is then transported to the JSRuntime thread (which
  * originated the request) and the wrapping WebAssembly.Module object is created
  * by calling createObject().
+ *
+ * Embeddings that keep the serialized bytes in memory (for instance, next to
+ * the .wasm response in a cache) can use the buffer overload of
+ * DeserializeWasmModule instead. It checks the compiled code's assumptions
+ * itself and silently recompiles from the bytecode if they no longer hold.
  */
 
 struct WasmModule : js::AtomicRefCounted<WasmModule>
@@ -6571,6 +6601,12 @@ extern JS_PUBLIC_API(RefPtr<WasmModule>)
 DeserializeWasmModule(PRFileDesc* bytecode, PRFileDesc* maybeCompiled, BuildIdCharVector&& buildId,
                       JS::UniqueChars filename, unsigned line, unsigned column);
 
+extern JS_PUBLIC_API(RefPtr<WasmModule>)
+DeserializeWasmModule(const uint8_t* bytecode, size_t bytecodeSize,
+                      const uint8_t* maybeCompiled, size_t compiledSize,
+                      BuildIdCharVector&& buildId, JS::UniqueChars filename,
+                      unsigned line, unsigned column);
+
 /**
  * Convenience class for imitating a JS level for-of loop. Typical usage:
  *
@@ -1404,21 +1404,41 @@ js::array_join(JSContext* cx, unsigned argc, Value* vp)
     // The separator will be added |length - 1| times, reserve space for that
     // so that we don't have to unnecessarily grow the buffer.
     size_t seplen = sepstr->length();
+    CheckedInt<uint32_t> res = 0;
     if (seplen > 0) {
         if (length > UINT32_MAX) {
             ReportAllocationOverflow(cx);
             return false;
         }
-        CheckedInt<uint32_t> res = CheckedInt<uint32_t>(seplen) * (uint32_t(length) - 1);
+        res = CheckedInt<uint32_t>(seplen) * (uint32_t(length) - 1);
         if (!res.isValid()) {
             ReportAllocationOverflow(cx);
             return false;
         }
+    }
 
-        if (!sb.reserve(res.value()))
+    // Joining many strings (e.g. pieces of generated HTML) is the common
+    // case, so also account for the leading run of string elements. This way
+    // the buffer is allocated once, and inflated to two-byte chars before any
+    // copying rather than halfway through.
+    if (obj->is<ArrayObject>()) {
+        ArrayObject* arr = &obj->as<ArrayObject>();
+        uint32_t initLength = uint32_t(Min<uint64_t>(arr->getDenseInitializedLength(), length));
+        bool twoByte = false;
+        for (uint32_t i = 0; i < initLength; i++) {
+            const Value& elem = arr->getDenseElement(i);
+            if (!elem.isString())
+                break;
+            res += elem.toString()->length();
+            twoByte |= elem.toString()->hasTwoByteChars();
+        }
+        if (twoByte && !sb.ensureTwoByteChars())
             return false;
     }
 
+    if (res.isValid() && res.value() > 0 && !sb.reserve(res.value()))
+        return false;
+
     // Various optimized versions of steps 6-7.
     if (seplen == 0) {
         EmptySeparatorOp op;
@@ -1845,31 +1865,7 @@ static const ComparatorNumeric SortComparatorNumerics[] = {
     ComparatorNumericRightMinusLeft
 };
 
-static bool
-ComparatorInt32LeftMinusRight(const Value& a, const Value& b, bool* lessOrEqualp)
-{
-    *lessOrEqualp = (a.toInt32() <= b.toInt32());
-    return true;
-}
-
-static bool
-ComparatorInt32RightMinusLeft(const Value& a, const Value& b, bool* lessOrEqualp)
-{
-    *lessOrEqualp = (b.toInt32() <= a.toInt32());
-    return true;
-}
-
-typedef bool (*ComparatorInt32)(const Value& a, const Value& b, bool* lessOrEqualp);
-
-static const ComparatorInt32 SortComparatorInt32s[] = {
-    nullptr,
-    nullptr,
-    ComparatorInt32LeftMinusRight,
-    ComparatorInt32RightMinusLeft
-};
-
-// Note: Values for this enum must match up with SortComparatorNumerics
-// and SortComparatorInt32s.
+// Note: Values for this enum must match up with SortComparatorNumerics.
 enum ComparatorMatchResult {
     Match_Failure = 0,
     Match_None,
@@ -2043,6 +2039,39 @@ SortNumerically(JSContext* cx, MutableHandle<GCVector<Value>> vec, size_t len,
                           SortComparatorNumerics[comp], vec);
 }
 
+/*
+ * Sort int32 Values as numbers.
+ *
+ * Int32 Values that compare equal are indistinguishable, so the sort need not
+ * be stable: copy the raw integers out, sort them with std::sort instead of
+ * calling a comparator per MergeSort step, and write them back in order.
+ */
+static bool
+SortInt32sNumerically(JSContext* cx, MutableHandle<GCVector<Value>> vec, size_t len,
+                      ComparatorMatchResult comp)
+{
+    MOZ_ASSERT(vec.length() >= len);
+    MOZ_ASSERT(comp == Match_LeftMinusRight || comp == Match_RightMinusLeft);
+
+    Vector<int32_t, 0, TempAllocPolicy> ints(cx);
+    if (!ints.resize(len))
+        return false;
+
+    for (size_t i = 0; i < len; i++)
+        ints[i] = vec[i].toInt32();
+
+    std::sort(ints.begin(), ints.end());
+
+    if (comp == Match_LeftMinusRight) {
+        for (size_t i = 0; i < len; i++)
+            vec[i].setInt32(ints[i]);
+    } else {
+        for (size_t i = 0; i < len; i++)
+            vec[i].setInt32(ints[len - 1 - i]);
+    }
+    return true;
+}
+
 static bool
 FillWithUndefined(JSContext* cx, HandleObject obj, uint32_t start, uint32_t count)
 {
@@ -2241,8 +2270,7 @@ js::intrinsic_ArrayNativeSort(JSContext* cx, unsigned argc, Value* vp)
             }
         } else {
             if (allInts) {
-                JS_ALWAYS_TRUE(vec.resize(n * 2));
-                if (!MergeSort(vec.begin(), n, vec.begin() + n, SortComparatorInt32s[comp]))
+                if (!SortInt32sNumerically(cx, &vec, n, comp))
                     return false;
             } else {
                 if (!SortNumerically(cx, &vec, n, comp))
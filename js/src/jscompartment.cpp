@@ -67,6 +67,8 @@ JSCompartment::JSCompartment(Zone* zone, const JS::CompartmentOptions& options =
 #endif
     global_(nullptr),
     enterCompartmentDepth(0),
+    gcsSinceLastEntered_(0),
+    relazifiedWhileCold_(false),
     performanceMonitoring(runtime_),
     data(nullptr),
     realmData(nullptr),
@@ -774,6 +776,8 @@ JSCompartment::traceRoots(JSTracer* trc, js::gc::GCRuntime::TraceOrMarkRuntime t
     if (lazyArrayBuffers)
         lazyArrayBuffers->trace(trc);
 
+    regExps.traceRecentRegExpShareds(trc);
+
     if (objectMetadataTable)
         objectMetadataTable->trace(trc);
 
@@ -641,17 +641,36 @@ struct JSCompartment
 
     unsigned                     enterCompartmentDepth;
 
+    // Number of major GCs that collected this compartment since it was last
+    // entered.
+    unsigned                     gcsSinceLastEntered_;
+
+    // Whether a GC has tried to relazify all the functions in this compartment
+    // since it was last entered or had its type information released (see
+    // RelazifyFunctionsInColdCompartments in jsgc.cpp).
+    bool                         relazifiedWhileCold_;
+
   public:
     js::PerformanceGroupHolder performanceMonitoring;
 
     void enter() {
         enterCompartmentDepth++;
+        gcsSinceLastEntered_ = 0;
+        relazifiedWhileCold_ = false;
     }
     void leave() {
         enterCompartmentDepth--;
     }
     bool hasBeenEntered() { return !!enterCompartmentDepth; }
 
+    unsigned gcsSinceLastEntered() const { return gcsSinceLastEntered_; }
+    void noteMajorGC() {
+        if (!hasBeenEntered() && gcsSinceLastEntered_ < UINT32_MAX)
+            gcsSinceLastEntered_++;
+    }
+    bool relazifiedWhileCold() const { return relazifiedWhileCold_; }
+    void setRelazifiedWhileCold(bool relazified) { relazifiedWhileCold_ = relazified; }
+
     JS::Zone* zone() { return zone_; }
     const JS::Zone* zone() const { return zone_; }
 
@@ -834,17 +834,35 @@ Chunk::decommitOneFreeArena(JSRuntime* rt, AutoLockGC& lock)
     return ok;
 }
 
+bool
+Chunk::isArenaFreeCommitted(size_t index)
+{
+    return !decommittedArenas.get(index) && !arenas[index].allocated();
+}
+
 void
 Chunk::decommitAllArenasWithoutUnlocking(const AutoLockGC& lock)
 {
-    for (size_t i = 0; i < ArenasPerChunk; ++i) {
-        if (decommittedArenas.get(i) || arenas[i].allocated())
+    // Decommit each run of contiguous free arenas with a single call rather
+    // than making one system call per arena.
+    size_t i = 0;
+    while (i < ArenasPerChunk) {
+        if (!isArenaFreeCommitted(i)) {
+            ++i;
             continue;
+        }
 
-        if (MarkPagesUnused(&arenas[i], ArenaSize)) {
-            info.numArenasFreeCommitted--;
-            decommittedArenas.set(i);
+        size_t end = i + 1;
+        while (end < ArenasPerChunk && isArenaFreeCommitted(end))
+            ++end;
+
+        if (MarkPagesUnused(&arenas[i], (end - i) * ArenaSize)) {
+            info.numArenasFreeCommitted -= end - i;
+            for (size_t j = i; j < end; ++j)
+                decommittedArenas.set(j);
         }
+
+        i = end;
     }
 }
 
@@ -2634,6 +2652,7 @@ GCRuntime::updateCellPointers(MovingTracer* trc, Zone* zone, AllocKinds kinds, s
     ArenasToUpdate fgArenas(zone, fgKinds);
     ArenasToUpdate bgArenas(zone, bgKinds);
     Maybe<UpdatePointersTask> fgTask;
+    Maybe<UpdatePointersTask> fgHelpTask;
     Maybe<UpdatePointersTask> bgTasks[MaxCellUpdateBackgroundTasks];
 
     size_t tasksStarted = 0;
@@ -2646,12 +2665,20 @@ GCRuntime::updateCellPointers(MovingTracer* trc, Zone* zone, AllocKinds kinds, s
         for (size_t i = 0; i < bgTaskCount && !bgArenas.done(); i++) {
             bgTasks[i].emplace(rt, &bgArenas, lock);
             startTask(*bgTasks[i], gcstats::PhaseKind::COMPACT_UPDATE_CELLS, lock);
-            tasksStarted = i;
+            tasksStarted = i + 1;
         }
+
+        if (tasksStarted)
+            fgHelpTask.emplace(rt, &bgArenas, lock);
     }
 
     fgTask->runFromActiveCooperatingThread(rt);
 
+    // Once the foreground-only kinds are done, help the background tasks with
+    // the remaining arenas rather than waiting idle for them to finish.
+    if (fgHelpTask)
+        fgHelpTask->runFromActiveCooperatingThread(rt);
+
     {
         AutoLockHelperThreadState lock;
 
@@ -4010,8 +4037,33 @@ GCRuntime::checkForCompartmentMismatches()
 }
 #endif
 
-static void
-RelazifyFunctions(Zone* zone, AllocKind kind)
+/*
+ * Number of major GCs a compartment must go without being entered before the
+ * functions in it are relazified by non-shrinking GCs.
+ */
+static const unsigned ColdCompartmentGCCount = 3;
+
+/*
+ * Maximum number of functions a non-shrinking GC relazifies in cold
+ * compartments. This bounds the extra work done on the main thread at the
+ * start of such GCs; functions left over are relazified by later GCs.
+ */
+static const int64_t ColdCompartmentRelazificationBudget = 10000;
+
+static bool
+IsColdCompartment(JSCompartment* comp)
+{
+    return comp->gcsSinceLastEntered() >= ColdCompartmentGCCount &&
+           !comp->relazifiedWhileCold();
+}
+
+/*
+ * Relazify the functions in |zone|, or only those in cold compartments if a
+ * |coldBudget| is given, stepping it once per function. Returns false if the
+ * budget ran out before all of them were visited.
+ */
+static bool
+RelazifyFunctions(Zone* zone, AllocKind kind, SliceBudget* coldBudget)
 {
     MOZ_ASSERT(kind == AllocKind::FUNCTION ||
                kind == AllocKind::FUNCTION_EXTENDED);
@@ -4021,9 +4073,20 @@ RelazifyFunctions(Zone* zone, AllocKind kind)
     JSRuntime* rt = zone->runtimeFromActiveCooperatingThread();
     for (auto i = zone->cellIter<JSObject>(kind, empty); !i.done(); i.next()) {
         JSFunction* fun = &i->as<JSFunction>();
-        if (fun->hasScript())
-            fun->maybeRelazify(rt);
+        if (!fun->hasScript())
+            continue;
+        if (coldBudget) {
+            if (!IsColdCompartment(fun->compartment()))
+                continue;
+            if (coldBudget->isOverBudget())
+                return false;
+            coldBudget->step();
+        }
+        fun->maybeRelazify(rt);
+        if (!fun->hasScript())
+            rt->gc.stats().count(gcstats::STAT_RELAZIFIED_FUNCTIONS);
     }
+    return true;
 }
 
 static bool
@@ -4142,20 +4205,59 @@ RelazifyFunctionsForShrinkingGC(JSRuntime* rt)
     for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
         if (zone->isSelfHostingZone())
             continue;
-        RelazifyFunctions(zone, AllocKind::FUNCTION);
-        RelazifyFunctions(zone, AllocKind::FUNCTION_EXTENDED);
+        RelazifyFunctions(zone, AllocKind::FUNCTION, nullptr);
+        RelazifyFunctions(zone, AllocKind::FUNCTION_EXTENDED, nullptr);
+    }
+}
+
+static void
+RelazifyFunctionsInColdCompartments(JSRuntime* rt)
+{
+    gcstats::AutoPhase ap(rt->gc.stats(), gcstats::PhaseKind::RELAZIFY_FUNCTIONS);
+    SliceBudget budget{WorkBudget(ColdCompartmentRelazificationBudget)};
+    for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
+        if (zone->isSelfHostingZone())
+            continue;
+
+        bool hasColdCompartment = false;
+        for (CompartmentsInZoneIter comp(zone); !comp.done(); comp.next()) {
+            if (IsColdCompartment(comp)) {
+                hasColdCompartment = true;
+                break;
+            }
+        }
+        if (!hasColdCompartment)
+            continue;
+
+        if (!RelazifyFunctions(zone, AllocKind::FUNCTION, &budget) ||
+            !RelazifyFunctions(zone, AllocKind::FUNCTION_EXTENDED, &budget))
+        {
+            return;
+        }
+
+        // Every function in this zone's cold compartments has been visited.
+        // Those that couldn't be relazified yet (mostly because they still
+        // have type information) are retried once their types are released.
+        for (CompartmentsInZoneIter comp(zone); !comp.done(); comp.next()) {
+            if (IsColdCompartment(comp))
+                comp->setRelazifiedWhileCold(true);
+        }
     }
 }
 
 static void
 PurgeShapeTablesForShrinkingGC(JSRuntime* rt)
 {
-    gcstats::AutoPhase ap(rt->gc.stats(), gcstats::PhaseKind::PURGE_SHAPE_TABLES);
+    // This runs on a helper thread, so iterate the arenas directly rather
+    // than using a ZoneCellIter, which may need to wait for background
+    // finalization or evict the nursery.
     for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
         if (zone->keepShapeTables() || zone->isSelfHostingZone())
             continue;
-        for (auto baseShape = zone->cellIter<BaseShape>(); !baseShape.done(); baseShape.next())
-            baseShape->maybePurgeTable();
+        for (ArenaIter aiter(zone, AllocKind::BASE_SHAPE); !aiter.done(); aiter.next()) {
+            for (ArenaCellIterUnderGC i(aiter.get()); !i.done(); i.next())
+                i.get<BaseShape>()->maybePurgeTable();
+        }
     }
 }
 
@@ -4222,6 +4324,17 @@ GCRuntime::beginMarkPhase(JS::gcreason::Reason reason, AutoLockForExclusiveAcces
         Maybe<AutoRunParallelTask> bufferGrayRoots;
         if (isIncremental)
             bufferGrayRoots.emplace(rt, BufferGrayRoots, gcstats::PhaseKind::BUFFER_GRAY_ROOTS, helperLock);
+
+        /*
+         * Purge unused shape tables for shrinking collections. This touches
+         * every base shape in the collected zones and doesn't interact with
+         * the work below, so do it in parallel too.
+         */
+        Maybe<AutoRunParallelTask> purgeShapeTables;
+        if (invocationKind == GC_SHRINK) {
+            purgeShapeTables.emplace(rt, PurgeShapeTablesForShrinkingGC,
+                                     gcstats::PhaseKind::PURGE_SHAPE_TABLES, helperLock);
+        }
         AutoUnlockHelperThreadState unlock(helperLock);
 
         /*
@@ -4237,12 +4350,17 @@ GCRuntime::beginMarkPhase(JS::gcreason::Reason reason, AutoLockForExclusiveAcces
          * the current GC can collect the JSScripts we're unlinking here.  We do
          * this only when we're performing a shrinking GC, as too much
          * relazification can cause performance issues when we have to reparse
-         * the same functions over and over.
+         * the same functions over and over. Compartments that have not been
+         * entered for several GCs are unlikely to run their code again soon,
+         * so other GCs relazify functions in those too, a bounded number at a
+         * time and only once per period of not being entered.
          */
-        if (invocationKind == GC_SHRINK) {
+        for (GCCompartmentsIter comp(rt); !comp.done(); comp.next())
+            comp->noteMajorGC();
+        if (invocationKind == GC_SHRINK)
             RelazifyFunctionsForShrinkingGC(rt);
-            PurgeShapeTablesForShrinkingGC(rt);
-        }
+        else
+            RelazifyFunctionsInColdCompartments(rt);
 
         /*
          * We must purge the runtime at the beginning of an incremental GC. The
@@ -5399,8 +5517,17 @@ GCRuntime::sweepJitDataOnMainThread(FreeOp* fop)
     {
         gcstats::AutoPhase ap1(stats(), gcstats::PhaseKind::SWEEP_TYPES);
         gcstats::AutoPhase ap2(stats(), gcstats::PhaseKind::SWEEP_TYPES_BEGIN);
-        for (GCSweepGroupIter zone(rt); !zone.done(); zone.next())
-            zone->beginSweepTypes(fop, releaseObservedTypes && !zone->isPreservingCode());
+        for (GCSweepGroupIter zone(rt); !zone.done(); zone.next()) {
+            bool releaseTypes = releaseObservedTypes && !zone->isPreservingCode();
+            zone->beginSweepTypes(fop, releaseTypes);
+
+            // Functions whose types are released here may be relazified by
+            // the next GC, see RelazifyFunctionsInColdCompartments.
+            if (releaseTypes) {
+                for (CompartmentsInZoneIter comp(zone); !comp.done(); comp.next())
+                    comp->setRelazifiedWhileCold(false);
+            }
+        }
     }
 }
 
@@ -7804,6 +7931,19 @@ gc::MergeCompartments(JSCompartment* source, JSCompartment* target)
     // Atoms which are marked in source's zone are now marked in target's zone.
     cx->atomMarking().adoptMarkedAtoms(target->zone(), source->zone());
 
+    // Atoms in source's atom cache are therefore valid entries for target's
+    // cache. Carry them over so that main thread atomization of names the
+    // off thread parse already saw does not need the exclusive access lock.
+    // This is only a cache, so failing to add an entry is harmless.
+    AtomSet& targetAtomCache = target->zone()->atomCache();
+    for (AtomSet::Range r = source->zone()->atomCache().all(); !r.empty(); r.popFront()) {
+        JSAtom* atom = r.front().asPtrUnbarriered();
+        AtomSet::AddPtr p = targetAtomCache.lookupForAdd(AtomHasher::Lookup(atom));
+        if (!p)
+            mozilla::Unused << targetAtomCache.add(p, AtomStateEntry(atom, false));
+    }
+    source->zone()->atomCache().clear();
+
     // Merge script name maps in the target compartment's map.
     if (cx->runtime()->lcovOutput().isEnabled() && source->scriptNameMap) {
         AutoEnterOOMUnsafeRegion oomUnsafe;
@@ -962,6 +962,24 @@ ScriptedProxyHandler::has(JSContext* cx, HandleObject proxy, HandleId id, bool*
     return true;
 }
 
+// The [[Get]] and [[Set]] invariant checks only reject a trap result when the
+// target has a non-configurable own property. For plain objects and arrays we
+// can rule that out without side effects and skip building a descriptor,
+// which is most of the cost of a trap call on these common targets.
+static bool
+HasNoNonConfigurableOwnPropertyPure(JSObject* target, jsid id)
+{
+    if (!target->is<PlainObject>() && !target->is<ArrayObject>())
+        return false;
+
+    NativeObject* nobj = &target->as<NativeObject>();
+    if (JSID_IS_INT(id) && nobj->containsDenseElement(JSID_TO_INT(id)))
+        return !nobj->denseElementsAreFrozen();
+
+    Shape* shape = nobj->lookupPure(id);
+    return !shape || shape->configurable();
+}
+
 // ES8 rev 0c1bd3004329336774cbc90de727cd0cf5f11e93 9.5.8 Proxy.[[GetP]](P, Receiver)
 bool
 ScriptedProxyHandler::get(JSContext* cx, HandleObject proxy, HandleValue receiver, HandleId id,
@@ -1005,6 +1023,11 @@ ScriptedProxyHandler::get(JSContext* cx, HandleObject proxy, HandleValue receive
             return false;
     }
 
+    if (HasNoNonConfigurableOwnPropertyPure(target, id)) {
+        vp.set(trapResult);
+        return true;
+    }
+
     // Step 9.
     Rooted<PropertyDescriptor> desc(cx);
     if (!GetOwnPropertyDescriptor(cx, target, id, &desc))
@@ -1084,6 +1107,9 @@ ScriptedProxyHandler::set(JSContext* cx, HandleObject proxy, HandleId id, Handle
     if (!ToBoolean(trapResult))
         return result.fail(JSMSG_PROXY_SET_RETURNED_FALSE);
 
+    if (HasNoNonConfigurableOwnPropertyPure(target, id))
+        return result.succeed();
+
     // Step 10.
     Rooted<PropertyDescriptor> desc(cx);
     if (!GetOwnPropertyDescriptor(cx, target, id, &desc))
@@ -837,6 +837,13 @@ ArrayBufferObject::inlineDataPointer() const
     return static_cast<uint8_t*>(fixedData(JSCLASS_RESERVED_SLOTS(&class_)));
 }
 
+ArrayBufferObject::FreeInfo*
+ArrayBufferObject::freeInfo() const
+{
+    MOZ_ASSERT(isExternal());
+    return reinterpret_cast<FreeInfo*>(inlineDataPointer());
+}
+
 uint8_t*
 ArrayBufferObject::dataPointer() const
 {
@@ -864,8 +871,10 @@ ArrayBufferObject::releaseData(FreeOp* fop)
       case WASM:
         WasmArrayRawBuffer::Release(dataPointer());
         break;
-      case KIND_MASK:
-        MOZ_CRASH("bad bufferKind()");
+      case EXTERNAL:
+        if (freeInfo()->freeFunc)
+            freeInfo()->freeFunc(dataPointer(), freeInfo()->freeUserData);
+        break;
     }
 }
 
@@ -875,6 +884,12 @@ ArrayBufferObject::setDataPointer(BufferContents contents, OwnsState ownsData)
     setSlot(DATA_SLOT, PrivateValue(contents.data()));
     setOwnsData(ownsData);
     setFlags((flags() & ~KIND_MASK) | contents.kind());
+
+    if (isExternal()) {
+        auto info = freeInfo();
+        info->freeFunc = contents.freeFunc();
+        info->freeUserData = contents.freeUserData();
+    }
 }
 
 uint32_t
@@ -1063,6 +1078,13 @@ ArrayBufferObject::create(JSContext* cx, uint32_t nbytes, BufferContents content
                 nAllocated = contents.wasmBuffer()->allocatedBytes();
             cx->zone()->updateMallocCounter(nAllocated);
         }
+
+        // Make room for the free function in the inline data area.
+        if (contents.kind() == EXTERNAL) {
+            static_assert(sizeof(FreeInfo) % sizeof(Value) == 0,
+                          "FreeInfo must fill whole slots");
+            nslots += sizeof(FreeInfo) / sizeof(Value);
+        }
     } else {
         MOZ_ASSERT(ownsState == OwnsData);
         size_t usableSlots = NativeObject::MAX_FIXED_SLOTS - reservedSlots;
@@ -1162,7 +1184,7 @@ ArrayBufferObject::stealContents(JSContext* cx, Handle<ArrayBufferObject*> buffe
                                         (buffer->isWasm() && !buffer->isPreparedForAsmJS()));
     assertSameCompartment(cx, buffer);
 
-    BufferContents oldContents(buffer->dataPointer(), buffer->bufferKind());
+    BufferContents oldContents = buffer->contents();
 
     if (hasStealableContents) {
         // Return the old contents and reset the detached buffer's data
@@ -1210,8 +1232,9 @@ ArrayBufferObject::addSizeOfExcludingThis(JSObject* obj, mozilla::MallocSizeOf m
         MOZ_ASSERT(buffer.wasmMappedSize() >= buffer.byteLength());
         info->wasmGuardPages += buffer.wasmMappedSize() - buffer.byteLength();
         break;
-      case KIND_MASK:
-        MOZ_CRASH("bad bufferKind()");
+      case EXTERNAL:
+        // The embedding owns and reports this memory.
+        break;
     }
 }
 
@@ -1638,9 +1661,13 @@ JS_DetachArrayBuffer(JSContext* cx, HandleObject obj)
         return false;
     }
 
+    // External contents are released right away rather than kept alive
+    // until the detached buffer is finalized.
+    bool releaseContents = buffer->hasStealableContents() ||
+                           (buffer->isExternal() && buffer->ownsData());
     ArrayBufferObject::BufferContents newContents =
-        buffer->hasStealableContents() ? ArrayBufferObject::BufferContents::createPlain(nullptr)
-                                       : buffer->contents();
+        releaseContents ? ArrayBufferObject::BufferContents::createPlain(nullptr)
+                        : buffer->contents();
 
     ArrayBufferObject::detach(cx, buffer, newContents);
 
@@ -1690,6 +1717,23 @@ JS_NewArrayBufferWithExternalContents(JSContext* cx, size_t nbytes, void* data)
                                      /* proto = */ nullptr, TenuredObject);
 }
 
+JS_PUBLIC_API(JSObject*)
+JS_NewExternalArrayBuffer(JSContext* cx, size_t nbytes, void* data,
+                          JS::BufferContentsFreeFunc freeFunc, void* freeUserData)
+{
+    AssertHeapIsIdle();
+    CHECK_REQUEST(cx);
+
+    MOZ_ASSERT(data);
+    MOZ_ASSERT(freeFunc);
+
+    // On failure, |data| is still the caller's to release.
+    ArrayBufferObject::BufferContents contents =
+        ArrayBufferObject::BufferContents::createExternal(data, freeFunc, freeUserData);
+    return ArrayBufferObject::create(cx, nbytes, contents, ArrayBufferObject::OwnsData,
+                                     /* proto = */ nullptr, TenuredObject);
+}
+
 JS_FRIEND_API(bool)
 JS_IsArrayBufferObject(JSObject* obj)
 {
@@ -156,6 +156,7 @@ class ArrayBufferObject : public ArrayBufferObjectMaybeShared
         PLAIN               = 0, // malloced or inline data
         WASM                = 1,
         MAPPED              = 2,
+        EXTERNAL            = 3, // released through a caller-supplied function
 
         KIND_MASK           = 0x3
     };
@@ -201,11 +202,18 @@ class ArrayBufferObject : public ArrayBufferObjectMaybeShared
     class BufferContents {
         uint8_t* data_;
         BufferKind kind_;
+        JS::BufferContentsFreeFunc free_;
+        void* freeUserData_;
 
         friend class ArrayBufferObject;
 
-        BufferContents(uint8_t* data, BufferKind kind) : data_(data), kind_(kind) {
+        BufferContents(uint8_t* data, BufferKind kind,
+                       JS::BufferContentsFreeFunc freeFunc = nullptr,
+                       void* freeUserData = nullptr)
+          : data_(data), kind_(kind), free_(freeFunc), freeUserData_(freeUserData)
+        {
             MOZ_ASSERT((kind_ & ~KIND_MASK) == 0);
+            MOZ_ASSERT_IF(free_ || freeUserData_, kind_ == EXTERNAL);
         }
 
       public:
@@ -221,8 +229,16 @@ class ArrayBufferObject : public ArrayBufferObjectMaybeShared
             return BufferContents(static_cast<uint8_t*>(data), PLAIN);
         }
 
+        static BufferContents createExternal(void* data, JS::BufferContentsFreeFunc freeFunc,
+                                             void* freeUserData = nullptr)
+        {
+            return BufferContents(static_cast<uint8_t*>(data), EXTERNAL, freeFunc, freeUserData);
+        }
+
         uint8_t* data() const { return data_; }
         BufferKind kind() const { return kind_; }
+        JS::BufferContentsFreeFunc freeFunc() const { return free_; }
+        void* freeUserData() const { return freeUserData_; }
 
         explicit operator bool() const { return data_ != nullptr; }
         WasmArrayRawBuffer* wasmBuffer() const;
@@ -270,7 +286,8 @@ class ArrayBufferObject : public ArrayBufferObjectMaybeShared
 
     bool hasStealableContents() const {
         // Inline elements strictly adhere to the corresponding buffer.
-        return ownsData() && !isPreparedForAsmJS() && !isWasm();
+        // External contents can only be released by their free function.
+        return ownsData() && !isPreparedForAsmJS() && !isWasm() && !isExternal();
     }
 
     static void addSizeOfExcludingThis(JSObject* obj, mozilla::MallocSizeOf mallocSizeOf,
@@ -300,12 +317,24 @@ class ArrayBufferObject : public ArrayBufferObjectMaybeShared
 
     uint8_t* inlineDataPointer() const;
 
+    // EXTERNAL buffers never have inline data, so their free function and
+    // its argument are kept in the object's inline data area instead.
+    struct FreeInfo {
+        JS::BufferContentsFreeFunc freeFunc;
+        void* freeUserData;
+    };
+    FreeInfo* freeInfo() const;
+
   public:
     uint8_t* dataPointer() const;
     SharedMem<uint8_t*> dataPointerShared() const;
     uint32_t byteLength() const;
 
     BufferContents contents() const {
+        if (isExternal()) {
+            return BufferContents::createExternal(dataPointer(), freeInfo()->freeFunc,
+                                                  freeInfo()->freeUserData);
+        }
         return BufferContents(dataPointer(), bufferKind());
     }
     bool hasInlineData() const {
@@ -326,6 +355,7 @@ class ArrayBufferObject : public ArrayBufferObjectMaybeShared
     bool isPlain() const { return bufferKind() == PLAIN; }
     bool isWasm() const { return bufferKind() == WASM; }
     bool isMapped() const { return bufferKind() == MAPPED; }
+    bool isExternal() const { return bufferKind() == EXTERNAL; }
     bool isDetached() const { return flags() & DETACHED; }
     bool isPreparedForAsmJS() const { return flags() & FOR_ASMJS; }
 
@@ -26,13 +26,21 @@ GeneratorObject::create(JSContext* cx, AbstractFramePtr frame)
     Rooted<GlobalObject*> global(cx, cx->global());
     RootedNativeObject obj(cx);
     if (frame.script()->isStarGenerator() || frame.script()->isAsync()) {
-        RootedValue pval(cx);
-        RootedObject fun(cx, frame.callee());
-        // FIXME: This would be faster if we could avoid doing a lookup to get
-        // the prototype for the instance.  Bug 906600.
-        if (!GetProperty(cx, fun, fun, cx->names().prototype, &pval))
-            return nullptr;
-        RootedObject proto(cx, pval.isObject() ? &pval.toObject() : nullptr);
+        RootedObject proto(cx);
+
+        // The generator object backing an async function or async generator
+        // is internal and never exposed to script, so its prototype is not
+        // observable. Skip the |prototype| lookup on every call for those.
+        if (!frame.script()->isAsync()) {
+            RootedValue pval(cx);
+            RootedObject fun(cx, frame.callee());
+            // FIXME: This would be faster if we could avoid doing a lookup to
+            // get the prototype for the instance.  Bug 906600.
+            if (!GetProperty(cx, fun, fun, cx->names().prototype, &pval))
+                return nullptr;
+            if (pval.isObject())
+                proto = &pval.toObject();
+        }
         if (!proto) {
             proto = GlobalObject::getOrCreateStarGeneratorObjectPrototype(cx, global);
             if (!proto)
@@ -6,16 +6,19 @@
 
 #include "vm/JSONParser.h"
 
+#include "mozilla/HashFunctions.h"
 #include "mozilla/Range.h"
 #include "mozilla/RangedPtr.h"
 #include "mozilla/Sprintf.h"
 
 #include <ctype.h>
+#include <string.h>
 
 #include "jsarray.h"
 #include "jscompartment.h"
 #include "jsnum.h"
 #include "jsprf.h"
+#include "jsstr.h"
 
 #include "vm/StringBuffer.h"
 
@@ -57,6 +60,11 @@ JSONParserBase::trace(JSTracer* trc)
             }
         }
     }
+
+    for (size_t i = 0; i < StringValueCacheSize; i++) {
+        if (stringValueCache[i])
+            TraceRoot(trc, &stringValueCache[i], "JSONParser string value cache");
+    }
 }
 
 template <typename CharT>
@@ -106,6 +114,62 @@ JSONParserBase::errorReturn()
     return errorHandling == NoError;
 }
 
+template <typename CharT>
+JSFlatString*
+JSONParser<CharT>::newStringValue(const CharT* chars, size_t length)
+{
+    if (length > MaxCachedStringValueLength)
+        return NewStringCopyN<CanGC>(cx, chars, length);
+
+    size_t index = mozilla::HashString(chars, length) % StringValueCacheSize;
+    if (JSFlatString* cached = stringValueCache[index]) {
+        if (cached->length() == length) {
+            JS::AutoCheckCannotGC nogc;
+            bool equal = cached->hasLatin1Chars()
+                         ? EqualChars(cached->latin1Chars(nogc), chars, length)
+                         : EqualChars(cached->twoByteChars(nogc), chars, length);
+            if (equal)
+                return cached;
+        }
+    }
+
+    JSFlatString* str = NewStringCopyN<CanGC>(cx, chars, length);
+    if (str)
+        stringValueCache[index] = str;
+    return str;
+}
+
+/*
+ * Return the first character in [p, end) that can't appear unescaped in a
+ * JSON string: a quote, a backslash or a control character. Characters are
+ * tested a machine word at a time, using the usual bit tricks for finding a
+ * zero lane, before single characters are examined by the caller.
+ */
+template <typename CharT>
+static inline const CharT*
+SkipPlainStringChars(const CharT* p, const CharT* end)
+{
+    const size_t CharsPerWord = sizeof(uint64_t) / sizeof(CharT);
+    const uint64_t Ones = uint64_t(-1) / ((uint64_t(1) << (8 * sizeof(CharT))) - 1);
+    const uint64_t Highs = Ones << (8 * sizeof(CharT) - 1);
+
+    while (size_t(end - p) >= CharsPerWord) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+
+        uint64_t quote = word ^ (Ones * '"');
+        uint64_t backslash = word ^ (Ones * '\\');
+        uint64_t special = ((quote - Ones) & ~quote) |
+                           ((backslash - Ones) & ~backslash) |
+                           ((word - Ones * 0x20) & ~word);
+        if (special & Highs)
+            break;
+
+        p += CharsPerWord;
+    }
+    return p;
+}
+
 template <typename CharT>
 template <JSONParserBase::StringType ST>
 JSONParserBase::Token
@@ -129,13 +193,14 @@ JSONParser<CharT>::readString()
      * string directly from the source text.
      */
     CharPtr start = current;
+    current += SkipPlainStringChars(current.get(), end.get()) - current.get();
     for (; current < end; current++) {
         if (*current == '"') {
             size_t length = current - start;
             current++;
             JSFlatString* str = (ST == JSONParser::PropertyName)
                                 ? AtomizeChars(cx, start.get(), length)
-                                : NewStringCopyN<CanGC>(cx, start.get(), length);
+                                : newStringValue(start.get(), length);
             if (!str)
                 return token(OOM);
             return stringToken(str);
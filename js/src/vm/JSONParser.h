@@ -8,6 +8,7 @@
 #define vm_JSONParser_h
 
 #include "mozilla/Attributes.h"
+#include "mozilla/PodOperations.h"
 #include "mozilla/Range.h"
 
 #include "jspubtd.h"
@@ -103,6 +104,14 @@ class MOZ_STACK_CLASS JSONParserBase
     Vector<ElementVector*, 5> freeElements;
     Vector<PropertyVector*, 5> freeProperties;
 
+    // Short string values created so far, indexed by a hash of their
+    // characters. Enum-like values tend to repeat throughout JSON data, and
+    // sharing a single string for each avoids filling the GC heap with
+    // identical copies.
+    static const size_t StringValueCacheSize = 64;
+    static const size_t MaxCachedStringValueLength = 16;
+    JSFlatString* stringValueCache[StringValueCacheSize];
+
 #ifdef DEBUG
     Token lastToken;
 #endif
@@ -116,7 +125,9 @@ class MOZ_STACK_CLASS JSONParserBase
 #ifdef DEBUG
       , lastToken(Error)
 #endif
-    {}
+    {
+        mozilla::PodArrayZero(stringValueCache);
+    }
     ~JSONParserBase();
 
     // Allow move construction for use with Rooted.
@@ -130,7 +141,9 @@ class MOZ_STACK_CLASS JSONParserBase
 #ifdef DEBUG
       , lastToken(mozilla::Move(other.lastToken))
 #endif
-    {}
+    {
+        mozilla::PodArrayCopy(stringValueCache, other.stringValueCache);
+    }
 
 
     Value numberValue() const {
@@ -237,6 +250,7 @@ class MOZ_STACK_CLASS JSONParser : public JSONParserBase
 
   private:
     template<StringType ST> Token readString();
+    JSFlatString* newStringValue(const CharT* chars, size_t length);
 
     Token readNumber();
 
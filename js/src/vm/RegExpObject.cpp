@@ -1282,14 +1282,49 @@ RegExpCompartment::sweep(JSRuntime* rt)
     {
         optimizableRegExpInstanceShape_.set(nullptr);
     }
+
+    // Everything in the cache was marked as a root; forget it so that
+    // patterns not used again before the next GC can be collected.
+    recentRegExpShareds_.reset();
+}
+
+void
+RegExpCompartment::noteRegExpSharedUsed(RegExpShared* shared)
+{
+    if (!recentRegExpShareds_) {
+        // The cache is only an optimization, so don't report OOM.
+        recentRegExpShareds_.reset(js_pod_calloc<RegExpShared*>(RecentRegExpSharedCount));
+        if (!recentRegExpShareds_)
+            return;
+    }
+
+    HashNumber hash = DefaultHasher<RegExpShared*>::hash(shared);
+    recentRegExpShareds_[hash % RecentRegExpSharedCount] = shared;
+}
+
+void
+RegExpCompartment::traceRecentRegExpShareds(JSTracer* trc)
+{
+    // Let shrinking GCs discard the compiled code of cached patterns.
+    if (IsMarkingTrace(trc) && trc->runtime()->gc.isShrinkingGC())
+        return;
+
+    if (!recentRegExpShareds_)
+        return;
+
+    for (size_t i = 0; i < RecentRegExpSharedCount; i++)
+        TraceNullableRoot(trc, &recentRegExpShareds_[i], "recent RegExpShared");
 }
 
 RegExpShared*
 RegExpZone::get(JSContext* cx, HandleAtom source, RegExpFlag flags)
 {
     DependentAddPtr<Set> p(cx, set_, Key(source, flags));
-    if (p)
-        return *p;
+    if (p) {
+        RegExpShared* shared = *p;
+        cx->compartment()->regExps.noteRegExpSharedUsed(shared);
+        return shared;
+    }
 
     auto shared = Allocate<RegExpShared>(cx);
     if (!shared)
@@ -1302,6 +1337,7 @@ RegExpZone::get(JSContext* cx, HandleAtom source, RegExpFlag flags)
         return nullptr;
     }
 
+    cx->compartment()->regExps.noteRegExpSharedUsed(shared);
     return shared;
 }
 
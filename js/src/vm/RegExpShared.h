@@ -312,12 +312,29 @@ class RegExpCompartment
      */
     ReadBarriered<Shape*> optimizableRegExpInstanceShape_;
 
+    /*
+     * RegExpShareds looked up since this compartment's zone was last
+     * collected. These are traced as roots so that patterns which are
+     * recreated over and over, e.g. by |new RegExp(str)| in a template engine,
+     * keep their compiled code across GCs instead of being recompiled after
+     * every collection. The cache is direct-mapped, so colliding patterns
+     * simply evict each other. It is allocated on first use and freed when
+     * the zone is swept, so compartments that don't use regexps between GCs
+     * don't pay for it.
+     */
+    static const size_t RecentRegExpSharedCount = 64;
+    UniquePtr<RegExpShared*[], JS::FreePolicy> recentRegExpShareds_;
+
     ArrayObject* createMatchResultTemplateObject(JSContext* cx);
 
   public:
     explicit RegExpCompartment(Zone* zone);
 
     void sweep(JSRuntime* rt);
+    void traceRecentRegExpShareds(JSTracer* trc);
+
+    void noteRegExpSharedUsed(RegExpShared* shared);
+    bool hasRecentRegExpShareds() const { return !!recentRegExpShareds_; }
 
     /* Get or create template object used to base the result of .exec() on. */
     ArrayObject* getOrCreateMatchResultTemplateObject(JSContext* cx) {
@@ -2784,6 +2784,13 @@ JSRuntime::initSelfHosting(JSContext* cx)
 {
     MOZ_ASSERT(!selfHostingGlobal_);
 
+    /*
+     * Runtimes parented to another runtime (i.e. workers) never compile the
+     * self-hosted sources themselves: they share the parent's self-hosting
+     * global, and functions cloned from it share their bytecode through
+     * SharedScriptData (see CopyScript), so only the per-compartment JSScript
+     * and its GC things are created per worker.
+     */
     if (cx->runtime()->parentRuntime) {
         selfHostingGlobal_ = cx->runtime()->parentRuntime->selfHostingGlobal_;
         return true;
@@ -852,8 +852,19 @@ NativeObject::removeProperty(JSContext* cx, HandleNativeObject obj, jsid id_)
      */
     RootedShape spare(cx);
     if (obj->inDictionaryMode()) {
-        /* For simplicity, always allocate an accessor shape for now. */
-        spare = Allocate<AccessorShape>(cx);
+        /*
+         * The spare replaces whichever shape is last once |shape| is gone, so
+         * it only needs to be an accessor shape if that one is. Objects used
+         * as hash maps delete a lot and keep the spare as their last property,
+         * so don't pay for the larger kind when it isn't needed.
+         */
+        Shape* newLastProperty = shape == obj->lastProperty()
+                                 ? shape->parent.get()
+                                 : obj->lastProperty();
+        if (newLastProperty->isAccessorShape())
+            spare = Allocate<AccessorShape>(cx);
+        else
+            spare = Allocate<Shape>(cx);
         if (!spare)
             return false;
         new (spare) Shape(shape->base()->unowned(), 0);
@@ -138,8 +138,14 @@ js::DestroyTraceLogger(TraceLoggerThread* logger)
 bool
 TraceLoggerThread::init()
 {
-    if (!events.init())
-        return false;
+    MOZ_ASSERT(traceLoggerState);
+    if (traceLoggerState->continuousModeEnabled()) {
+        if (!events.initFixed(TraceLoggerThreadState::ContinuousModeEvents))
+            return false;
+    } else {
+        if (!events.init())
+            return false;
+    }
 
     // Minimum amount of capacity needed for operation to allow flushing.
     // Flushing requires space for the actual event and two spaces to log the
@@ -866,6 +872,9 @@ TraceLoggerThreadState::init()
                 "  EnableActiveThread      Start logging cooperating threads immediately.\n"
                 "  EnableOffThread         Start logging helper threads immediately.\n"
                 "  EnableGraph             Enable spewing the tracelogging graph to a file.\n"
+                "  Continuous              Log every thread into a fixed-size buffer, for\n"
+                "                          always-on logging. A full buffer is emptied (after\n"
+                "                          spewing it with EnableGraph) and logging restarts.\n"
                 "  Errors                  Report errors during tracing to stderr.\n"
             );
             printf("\n");
@@ -879,6 +888,8 @@ TraceLoggerThreadState::init()
             helperThreadEnabled = true;
         if (strstr(options, "EnableGraph"))
             graphSpewingEnabled = true;
+        if (strstr(options, "Continuous"))
+            continuousModeEnabled_ = true;
         if (strstr(options, "Errors"))
             spewErrors = true;
     }
@@ -383,6 +383,7 @@ class TraceLoggerThreadState
     bool cooperatingThreadEnabled;
     bool helperThreadEnabled;
     bool graphSpewingEnabled;
+    bool continuousModeEnabled_;
     bool spewErrors;
     mozilla::LinkedList<TraceLoggerThread> threadLoggers;
 
@@ -410,6 +411,7 @@ class TraceLoggerThreadState
         cooperatingThreadEnabled(false),
         helperThreadEnabled(false),
         graphSpewingEnabled(false),
+        continuousModeEnabled_(false),
         spewErrors(false),
         nextTextId(TraceLogger_Last),
         startupTime(0),
@@ -422,6 +424,15 @@ class TraceLoggerThreadState
     TraceLoggerThread* forCurrentThread(JSContext* cx);
     void destroyLogger(TraceLoggerThread* logger);
 
+    // In continuous mode every thread logs into a small fixed-size buffer
+    // that is emptied and restarted whenever it fills up, so that logging can
+    // stay on indefinitely. Only the events logged since the last restart
+    // can be inspected.
+    static const uint32_t ContinuousModeEvents = 64 * 1024;
+    bool continuousModeEnabled() const {
+        return continuousModeEnabled_;
+    }
+
     bool isTextIdEnabled(uint32_t textId) {
         if (textId < TraceLogger_Last)
             return enabledTextIds[textId];
@@ -156,13 +156,15 @@ class ContinuousSpace {
     T* data_;
     uint32_t size_;
     uint32_t capacity_;
+    uint32_t maxSize_;
 
     // The maximum number of bytes of RAM a continuous space structure can take.
     static const uint32_t LIMIT = 200 * 1024 * 1024;
 
   public:
     ContinuousSpace ()
-     : data_(nullptr)
+     : data_(nullptr),
+       maxSize_(LIMIT / sizeof(T))
     { }
 
     bool init() {
@@ -175,14 +177,28 @@ class ContinuousSpace {
         return true;
     }
 
+    // Limit the space to |maxEntries| entries and allocate all of them up
+    // front, so that adding entries never reallocates.
+    bool initFixed(uint32_t maxEntries) {
+        MOZ_ASSERT(maxEntries > 0 && maxEntries <= LIMIT / sizeof(T));
+        maxSize_ = maxEntries;
+        capacity_ = maxEntries;
+        size_ = 0;
+        data_ = (T*) js_malloc(capacity_ * sizeof(T));
+        if (!data_)
+            return false;
+
+        return true;
+    }
+
     ~ContinuousSpace()
     {
         js_free(data_);
         data_ = nullptr;
     }
 
-    static uint32_t maxSize() {
-        return LIMIT / sizeof(T);
+    uint32_t maxSize() const {
+        return maxSize_;
     }
 
     T* data() {
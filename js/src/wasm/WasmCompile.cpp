@@ -23,6 +23,7 @@
 
 #include "jsprf.h"
 
+#include "jit/JitOptions.h"
 #include "wasm/WasmBaselineCompile.h"
 #include "wasm/WasmBinaryIterator.h"
 #include "wasm/WasmGenerator.h"
@@ -33,6 +34,9 @@ using namespace js;
 using namespace js::jit;
 using namespace js::wasm;
 
+using mozilla::Max;
+using mozilla::Min;
+
 static bool
 DecodeFunctionBody(Decoder& d, ModuleGenerator& mg, uint32_t funcIndex)
 {
@@ -136,6 +140,24 @@ BackgroundWorkPossible()
     return CanUseExtraThreads() && HelperThreadState().cpuCount > 1;
 }
 
+// Tiering only pays off when Ion would take long enough to compile the module
+// that starting out in baseline code is noticeably faster. Small modules
+// compile with Ion at once, avoiding a second compilation and the baseline
+// code's slower steady state. See JitOptions.cpp for where the throughput
+// estimate and the cutoff come from; both can be tuned through prefs.
+
+static bool
+TieringBeneficial(size_t bytecodeLength)
+{
+    size_t cpuCount = HelperThreadState().cpuCount;
+    size_t workers = HelperThreadState().maxWasmCompilationThreads();
+    size_t cores = Max(Min(cpuCount, workers), size_t(1));
+
+    double bytecodesPerMs = double(JitOptions.wasmIonBytecodesPerMs) * cores;
+    double ionCompileMs = double(bytecodeLength) / bytecodesPerMs;
+    return ionCompileMs > double(JitOptions.wasmTierCutoffMs);
+}
+
 bool
 wasm::GetDebugEnabled(const CompileArgs& args, ModuleKind kind)
 {
@@ -146,12 +168,13 @@ wasm::GetDebugEnabled(const CompileArgs& args, ModuleKind kind)
 }
 
 wasm::CompileMode
-wasm::GetInitialCompileMode(const CompileArgs& args, ModuleKind kind)
+wasm::GetInitialCompileMode(const CompileArgs& args, size_t bytecodeLength, ModuleKind kind)
 {
     bool baselineEnabled, debugEnabled, ionEnabled;
     CompilerAvailability(kind, args, &baselineEnabled, &debugEnabled, &ionEnabled);
 
-    return BackgroundWorkPossible() && baselineEnabled && ionEnabled && !debugEnabled
+    return BackgroundWorkPossible() && baselineEnabled && ionEnabled && !debugEnabled &&
+           TieringBeneficial(bytecodeLength)
            ? CompileMode::Tier1
            : CompileMode::Once;
 }
@@ -211,7 +234,7 @@ wasm::CompileInitialTier(const ShareableBytes& bytecode, const CompileArgs& args
 {
     ModuleGenerator mg(error, nullptr);
 
-    CompileMode mode = GetInitialCompileMode(args);
+    CompileMode mode = GetInitialCompileMode(args, bytecode.length());
     if (!Compile(mg, bytecode, args, error, mode))
         return nullptr;
 
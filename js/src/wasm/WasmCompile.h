@@ -85,13 +85,16 @@ GetDebugEnabled(const CompileArgs& args, ModuleKind kind = ModuleKind::Wasm);
 
 // Select the mode for the initial compilation of a module.  The mode is "Tier1"
 // precisely if both compilers are available, we're not debugging, and it is
-// possible to compile in the background, and in that case, we'll compile twice,
-// with the mode set to "Tier2" during the second (background) compilation.
+// possible to compile in the background, and the module is large enough that
+// an Ion compilation would noticeably delay startup.  In that case, we'll
+// compile twice, with the mode set to "Tier2" during the second (background)
+// compilation.
 // Otherwise, the tier is "Once" and we'll compile once, with the appropriate
 // compiler.
 
 CompileMode
-GetInitialCompileMode(const CompileArgs& args, ModuleKind kind = ModuleKind::Wasm);
+GetInitialCompileMode(const CompileArgs& args, size_t bytecodeLength,
+                      ModuleKind kind = ModuleKind::Wasm);
 
 // Select the tier for a compilation.  The tier is Tier::Baseline if we're
 // debugging, if Baldr is not available, or if both compilers are are available
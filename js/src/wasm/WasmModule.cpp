@@ -536,34 +536,33 @@ wasm::CompiledModuleAssumptionsMatch(PRFileDesc* compiled, JS::BuildIdCharVector
 }
 
 SharedModule
-wasm::DeserializeModule(PRFileDesc* bytecodeFile, PRFileDesc* maybeCompiledFile,
+wasm::DeserializeModule(const uint8_t* bytecodeBegin, size_t bytecodeSize,
+                        const uint8_t* maybeCompiledBegin, size_t compiledSize,
                         JS::BuildIdCharVector&& buildId, UniqueChars filename,
                         unsigned line, unsigned column)
 {
-    PRFileInfo bytecodeInfo;
-    UniqueMapping bytecodeMapping = MapFile(bytecodeFile, &bytecodeInfo);
-    if (!bytecodeMapping)
-        return nullptr;
-
-    if (PRFileDesc* compiledFile = maybeCompiledFile) {
-        PRFileInfo compiledInfo;
-        UniqueMapping compiledMapping = MapFile(compiledFile, &compiledInfo);
-        if (!compiledMapping)
-            return nullptr;
-
-        return Module::deserialize(bytecodeMapping.get(), bytecodeInfo.size,
-                                   compiledMapping.get(), compiledInfo.size);
+    if (maybeCompiledBegin) {
+        // Unlike the file-based path, callers of this overload (for example,
+        // a cache holding the compiled code next to the bytecode) have not
+        // checked the assumptions beforehand, so do it here and fall back to
+        // compiling from bytecode on a mismatch.
+        Assumptions current(Move(buildId));
+        if (Module::assumptionsMatch(current, maybeCompiledBegin, compiledSize)) {
+            return Module::deserialize(bytecodeBegin, bytecodeSize,
+                                       maybeCompiledBegin, compiledSize);
+        }
+        buildId = Move(current.buildId);
     }
 
-    // Since the compiled file's assumptions don't match, we must recompile from
-    // bytecode. The bytecode file format is simply that of a .wasm (see
+    // Since the compiled code's assumptions don't match, we must recompile from
+    // bytecode. The bytecode format is simply that of a .wasm (see
     // Module::serialize).
 
     MutableBytes bytecode = js_new<ShareableBytes>();
-    if (!bytecode || !bytecode->bytes.initLengthUninitialized(bytecodeInfo.size))
+    if (!bytecode || !bytecode->bytes.initLengthUninitialized(bytecodeSize))
         return nullptr;
 
-    memcpy(bytecode->bytes.begin(), bytecodeMapping.get(), bytecodeInfo.size);
+    memcpy(bytecode->bytes.begin(), bytecodeBegin, bytecodeSize);
 
     ScriptedCaller scriptedCaller;
     scriptedCaller.filename = Move(filename);
@@ -578,6 +577,30 @@ wasm::DeserializeModule(PRFileDesc* bytecodeFile, PRFileDesc* maybeCompiledFile,
     return CompileInitialTier(*bytecode, *args, &error);
 }
 
+SharedModule
+wasm::DeserializeModule(PRFileDesc* bytecodeFile, PRFileDesc* maybeCompiledFile,
+                        JS::BuildIdCharVector&& buildId, UniqueChars filename,
+                        unsigned line, unsigned column)
+{
+    PRFileInfo bytecodeInfo;
+    UniqueMapping bytecodeMapping = MapFile(bytecodeFile, &bytecodeInfo);
+    if (!bytecodeMapping)
+        return nullptr;
+
+    if (PRFileDesc* compiledFile = maybeCompiledFile) {
+        PRFileInfo compiledInfo;
+        UniqueMapping compiledMapping = MapFile(compiledFile, &compiledInfo);
+        if (!compiledMapping)
+            return nullptr;
+
+        return Module::deserialize(bytecodeMapping.get(), bytecodeInfo.size,
+                                   compiledMapping.get(), compiledInfo.size);
+    }
+
+    return DeserializeModule(bytecodeMapping.get(), bytecodeInfo.size, nullptr, 0,
+                             Move(buildId), Move(filename), line, column);
+}
+
 /* virtual */ void
 Module::addSizeOfMisc(MallocSizeOf mallocSizeOf,
                       Metadata::SeenSet* seenMetadata,
@@ -278,6 +278,12 @@ SharedModule
 DeserializeModule(PRFileDesc* bytecode, PRFileDesc* maybeCompiled, JS::BuildIdCharVector&& buildId,
                   UniqueChars filename, unsigned line, unsigned column);
 
+SharedModule
+DeserializeModule(const uint8_t* bytecodeBegin, size_t bytecodeSize,
+                  const uint8_t* maybeCompiledBegin, size_t compiledSize,
+                  JS::BuildIdCharVector&& buildId, UniqueChars filename,
+                  unsigned line, unsigned column);
+
 } // namespace wasm
 } // namespace js
 
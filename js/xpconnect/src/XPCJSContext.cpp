@@ -699,6 +699,9 @@ ReloadPrefsCallback(const char* pref, void* data)
 
     int32_t baselineThreshold = Preferences::GetInt(JS_OPTIONS_DOT_STR "baselinejit.threshold", -1);
     int32_t ionThreshold = Preferences::GetInt(JS_OPTIONS_DOT_STR "ion.threshold", -1);
+    int32_t wasmTierCutoff = Preferences::GetInt(JS_OPTIONS_DOT_STR "wasm_tier_cutoff_ms", -1);
+    int32_t wasmIonBytecodesPerMs =
+        Preferences::GetInt(JS_OPTIONS_DOT_STR "wasm_ion_bytecodes_per_ms", -1);
 
     sDiscardSystemSource = Preferences::GetBool(JS_OPTIONS_DOT_STR "discardSystemSource");
 
@@ -760,6 +763,9 @@ ReloadPrefsCallback(const char* pref, void* data)
                                   useBaselineEager ? 0 : baselineThreshold);
     JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_ION_WARMUP_TRIGGER,
                                   useIonEager ? 0 : ionThreshold);
+    JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_WASM_TIER_CUTOFF, wasmTierCutoff);
+    JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_WASM_ION_BYTECODES_PER_MS,
+                                  wasmIonBytecodesPerMs);
 #ifdef DEBUG
     JS_SetGlobalJitCompilerOption(cx, JSJITCOMPILER_FULL_DEBUG_CHECKS, fullJitDebugChecks);
 #endif
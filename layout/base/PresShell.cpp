@@ -855,6 +855,7 @@ PresShell::PresShell()
   mRenderFlags = 0;
 
   mScrollPositionClampingScrollPortSizeSet = false;
+  mPreviousApproximatelyVisibleFrames = nullptr;
 
   static bool addedSynthMouseMove = false;
   if (!addedSynthMouseMove) {
@@ -5919,8 +5920,14 @@ PresShell::MarkFramesInSubtreeApproximatelyVisible(nsIFrame* aFrame,
       (!aRemoveOnly || aFrame->GetVisibility() == Visibility::APPROXIMATELY_VISIBLE)) {
     MOZ_ASSERT(!AssumeAllFramesVisible());
     if (mApproximatelyVisibleFrames.EnsureInserted(aFrame)) {
-      // The frame was added to mApproximatelyVisibleFrames, so increment its visible count.
-      aFrame->IncApproximateVisibleCount();
+      // The frame was added to mApproximatelyVisibleFrames. If it was already
+      // visible before this rebuild, just carry its visible count over rather
+      // than incrementing it now and decrementing it again afterwards;
+      // otherwise increment its visible count.
+      if (!mPreviousApproximatelyVisibleFrames ||
+          !mPreviousApproximatelyVisibleFrames->EnsureRemoved(aFrame)) {
+        aFrame->IncApproximateVisibleCount();
+      }
     }
 
     AddFrameToVisibleRegions(aFrame, mViewManager, aVisibleRegions);
@@ -6048,7 +6055,12 @@ PresShell::RebuildApproximateFrameVisibility(nsRect* aRect,
     vis = *aRect;
   }
 
+  // Frames that are still visible get removed from
+  // oldApproximatelyVisibleFrames as we go, so that only the frames that are
+  // no longer visible are left in it afterwards.
+  mPreviousApproximatelyVisibleFrames = &oldApproximatelyVisibleFrames;
   MarkFramesInSubtreeApproximatelyVisible(rootFrame, vis, visibleRegions, aRemoveOnly);
+  mPreviousApproximatelyVisibleFrames = nullptr;
 
   DecApproximateVisibleCount(oldApproximatelyVisibleFrames);
 
@@ -9477,6 +9489,28 @@ PresShell::DoVerifyReflow()
 // used with Telemetry metrics
 #define NS_LONG_REFLOW_TIME_MS    5000
 
+// Reorder aDirtyRoots so that the roots that are (or may be) visible in the
+// viewport get reflowed before the ones that are scrolled out of view.  Dirty
+// roots are processed from the end of the array, so visible ones go last.
+// This only affects the order; all roots still get reflowed eventually.
+static void
+PrioritizeVisibleDirtyRoots(nsTArray<nsIFrame*>& aDirtyRoots,
+                            nsIFrame* aRootFrame, const nsRect& aViewport)
+{
+  std::stable_partition(aDirtyRoots.begin(), aDirtyRoots.end(),
+    [&](nsIFrame* aFrame) {
+      nsRect rect = aFrame->GetVisualOverflowRect();
+      // Frames that haven't been reflowed yet have no meaningful geometry,
+      // so treat them as visible.
+      if (rect.IsEmpty() || aFrame == aRootFrame) {
+        return false;
+      }
+      // This ignores transforms, which is fine for a heuristic.
+      rect += aFrame->GetOffsetTo(aRootFrame);
+      return !rect.Intersects(aViewport);
+    });
+}
+
 bool
 PresShell::ProcessReflowCommands(bool aInterruptible)
 {
@@ -9507,6 +9541,14 @@ PresShell::ProcessReflowCommands(bool aInterruptible)
       AUTO_LAYOUT_PHASE_ENTRY_POINT(GetPresContext(), Reflow);
       nsViewManager::AutoDisableRefresh refreshBlocker(mViewManager);
 
+      // If we may run out of time, spend it on what the user can see first.
+      nsIFrame* rootFrame = mFrameConstructor->GetRootFrame();
+      if (aInterruptible && rootFrame && mDirtyRoots.Length() > 1) {
+        PrioritizeVisibleDirtyRoots(
+          mDirtyRoots, rootFrame,
+          nsRect(nsPoint(0, 0), mPresContext->GetVisibleArea().Size()));
+      }
+
       do {
         // Send an incremental reflow notification to the target frame.
         int32_t idx = mDirtyRoots.Length() - 1;
@@ -763,6 +763,10 @@ protected:
   // that we last did an approximate frame visibility update.
   VisibleFrames mApproximatelyVisibleFrames;
 
+  // While RebuildApproximateFrameVisibility is running, the frames that were
+  // in mApproximatelyVisibleFrames before the rebuild started. Null otherwise.
+  VisibleFrames* mPreviousApproximatelyVisibleFrames;
+
   nsresult SetResolutionImpl(float aResolution, bool aScaleToResolution);
 
 #ifdef DEBUG
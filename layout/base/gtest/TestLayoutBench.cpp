@@ -0,0 +1,237 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Benchmarks of the layout phases on synthetic documents (deep flex, a big
+// table, long text), each loaded into the PresShell of a windowless browser.
+// Every iteration loads a fresh document and times one phase only, driven
+// through the same entry points that nsAutoLayoutPhase guards:
+//
+//   FrameConstruction  Flush after un-hiding the whole body. This includes
+//                      the restyle of the newly displayed subtree.
+//   Restyle            Flush after an inherited style change on the body,
+//                      which restyles every element without reframing.
+//   Reflow             Layout flush after a change of the body's width.
+//   DisplayList        Building (and destroying) the painting display list
+//                      of the root frame.
+//
+// Results are reported through MOZ_GTEST_BENCH_TIMED, i.e. as Perfherder JSON
+// on stdout; debug builds run each benchmark once without reporting.
+
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h" // For MOZ_GTEST_BENCH_TIMED
+
+#include "mozilla/dom/Element.h"
+#include "mozilla/ErrorResult.h"
+#include "mozilla/FlushType.h"
+#include "mozilla/TimeStamp.h"
+#include "nsAppShellCID.h"
+#include "nsCOMPtr.h"
+#include "nsDisplayList.h"
+#include "nsGkAtoms.h"
+#include "nsIAppShellService.h"
+#include "nsIBaseWindow.h"
+#include "nsIDocShell.h"
+#include "nsIDocument.h"
+#include "nsIDOMDocument.h"
+#include "nsIFrame.h"
+#include "nsIInterfaceRequestorUtils.h"
+#include "nsIPresShell.h"
+#include "nsIWindowlessBrowser.h"
+#include "nsServiceManagerUtils.h"
+#include "nsString.h"
+
+using namespace mozilla;
+using namespace mozilla::dom;
+
+static const int32_t kViewportWidth = 1024;
+static const int32_t kViewportHeight = 768;
+
+// The synthetic documents. The style sheet goes in the body too, since the
+// document is filled in through the body's innerHTML.
+
+static const char16_t kBenchStyle[] =
+  u"<style>"
+  u".alt { color: blue; }"
+  u".f { display: flex; padding: 1px; }"
+  u".f > span { flex: 1; }"
+  u"td { border: 1px solid; padding: 2px; }"
+  u"</style>";
+
+static nsString
+DeepFlexDocument()
+{
+  nsString html(kBenchStyle);
+  const int depth = 200;
+  for (int i = 0; i < depth; i++) {
+    html.AppendLiteral("<div class=f><span>item</span><span>item</span>");
+  }
+  for (int i = 0; i < depth; i++) {
+    html.AppendLiteral("</div>");
+  }
+  return html;
+}
+
+static nsString
+BigTableDocument()
+{
+  nsString html(kBenchStyle);
+  html.AppendLiteral("<table>");
+  for (int row = 0; row < 500; row++) {
+    html.AppendLiteral("<tr>");
+    for (int col = 0; col < 10; col++) {
+      html.AppendPrintf("<td>cell %d.%d</td>", row, col);
+    }
+    html.AppendLiteral("</tr>");
+  }
+  html.AppendLiteral("</table>");
+  return html;
+}
+
+static nsString
+LongTextDocument()
+{
+  nsString html(kBenchStyle);
+  for (int i = 0; i < 500; i++) {
+    html.AppendLiteral("<p>");
+    for (int j = 0; j < 10; j++) {
+      html.AppendLiteral("Lorem ipsum dolor sit amet, consectetur adipiscing "
+                         "elit, sed do eiusmod tempor incididunt ut labore. ");
+    }
+    html.AppendLiteral("</p>");
+  }
+  return html;
+}
+
+// A windowless browser whose document body holds aBody, laid out in a
+// kViewportWidth x kViewportHeight viewport.
+class LayoutBenchDocument
+{
+public:
+  explicit LayoutBenchDocument(const nsAString& aBody)
+  {
+    nsCOMPtr<nsIAppShellService> appShell =
+      do_GetService(NS_APPSHELLSERVICE_CONTRACTID);
+    MOZ_RELEASE_ASSERT(appShell);
+    nsresult rv = appShell->CreateWindowlessBrowser(false,
+                                                    getter_AddRefs(mBrowser));
+    MOZ_RELEASE_ASSERT(NS_SUCCEEDED(rv));
+
+    // This creates the initial about:blank document and its PresShell.
+    nsCOMPtr<nsIDOMDocument> domDocument;
+    mBrowser->GetDocument(getter_AddRefs(domDocument));
+    mDocument = do_QueryInterface(domDocument);
+    MOZ_RELEASE_ASSERT(mDocument);
+
+    nsCOMPtr<nsIDocShell> docShell = do_GetInterface(mBrowser);
+    nsCOMPtr<nsIBaseWindow> window = do_QueryInterface(docShell);
+    MOZ_RELEASE_ASSERT(window);
+    window->SetPositionAndSize(0, 0, kViewportWidth, kViewportHeight, 0);
+
+    ErrorResult error;
+    Body()->SetInnerHTML(aBody, error);
+    MOZ_RELEASE_ASSERT(!error.Failed());
+    Flush(FlushType::Layout);
+    MOZ_RELEASE_ASSERT(mDocument->GetShell());
+  }
+
+  ~LayoutBenchDocument()
+  {
+    mBrowser->Close();
+  }
+
+  Element* Body() { return mDocument->GetBodyElement(); }
+  nsIPresShell* PresShell() { return mDocument->GetShell(); }
+
+  void Flush(FlushType aType) { mDocument->FlushPendingNotifications(aType); }
+
+  void SetBodyStyle(const char16_t* aStyle)
+  {
+    Body()->SetAttr(kNameSpaceID_None, nsGkAtoms::style,
+                    nsDependentString(aStyle), true);
+  }
+
+private:
+  nsCOMPtr<nsIWindowlessBrowser> mBrowser;
+  nsCOMPtr<nsIDocument> mDocument;
+};
+
+static double
+TimeFlush(LayoutBenchDocument& aDocument, FlushType aType)
+{
+  TimeStamp start = TimeStamp::Now();
+  aDocument.Flush(aType);
+  return (TimeStamp::Now() - start).ToMicroseconds();
+}
+
+static double
+BenchFrameConstruction(const nsString& aBody)
+{
+  LayoutBenchDocument document(aBody);
+  document.SetBodyStyle(u"display: none");
+  document.Flush(FlushType::Layout);
+
+  // Style and frame construction are flushed together (FlushType::Frames is
+  // FlushType::Style).
+  document.SetBodyStyle(u"");
+  return TimeFlush(document, FlushType::Frames);
+}
+
+static double
+BenchRestyle(const nsString& aBody)
+{
+  LayoutBenchDocument document(aBody);
+  document.Body()->SetAttr(kNameSpaceID_None, nsGkAtoms::_class,
+                           NS_LITERAL_STRING("alt"), true);
+  return TimeFlush(document, FlushType::Style);
+}
+
+static double
+BenchReflow(const nsString& aBody)
+{
+  LayoutBenchDocument document(aBody);
+  document.SetBodyStyle(u"width: 700px");
+  document.Flush(FlushType::Style);
+  return TimeFlush(document, FlushType::Layout);
+}
+
+static double
+BenchDisplayList(const nsString& aBody)
+{
+  LayoutBenchDocument document(aBody);
+  nsIFrame* rootFrame = document.PresShell()->GetRootFrame();
+  MOZ_RELEASE_ASSERT(rootFrame);
+
+  TimeStamp start = TimeStamp::Now();
+  nsDisplayListBuilder builder(rootFrame, nsDisplayListBuilderMode::PAINTING,
+                               false);
+  builder.IgnorePaintSuppression();
+  nsDisplayList list;
+  builder.EnterPresShell(rootFrame);
+  builder.SetDirtyRect(rootFrame->GetVisualOverflowRectRelativeToSelf());
+  rootFrame->BuildDisplayListForStackingContext(&builder, &list);
+  builder.LeavePresShell(rootFrame, &list);
+  list.DeleteAll(&builder);
+  return (TimeStamp::Now() - start).ToMicroseconds();
+}
+
+#define LAYOUT_BENCH(document_, phase_)                                     \
+  MOZ_GTEST_BENCH_TIMED(LayoutBench, document_##_##phase_, [] {             \
+    return Bench##phase_(document_##Document());                            \
+  })
+
+LAYOUT_BENCH(DeepFlex, FrameConstruction);
+LAYOUT_BENCH(DeepFlex, Restyle);
+LAYOUT_BENCH(DeepFlex, Reflow);
+LAYOUT_BENCH(DeepFlex, DisplayList);
+
+LAYOUT_BENCH(BigTable, FrameConstruction);
+LAYOUT_BENCH(BigTable, Restyle);
+LAYOUT_BENCH(BigTable, Reflow);
+LAYOUT_BENCH(BigTable, DisplayList);
+
+LAYOUT_BENCH(LongText, FrameConstruction);
+LAYOUT_BENCH(LongText, Restyle);
+LAYOUT_BENCH(LongText, Reflow);
+LAYOUT_BENCH(LongText, DisplayList);
@@ -767,6 +767,42 @@ nsBidiPresUtils::Resolve(nsBlockFrame* aBlockFrame)
   return ResolveParagraph(&bpd);
 }
 
+// Returns whether aFrame and its inline ancestors (up to the block) have no
+// bidi continuations, i.e. all their continuations are fluid.
+static bool
+HasOnlyFluidContinuations(nsIFrame* aFrame)
+{
+  for (nsIFrame* f = aFrame;
+       f && !f->IsFrameOfType(nsIFrame::eBlockFrame);
+       f = f->GetParent()) {
+    if (f->GetPrevContinuation() != f->GetPrevInFlow() ||
+        f->GetNextContinuation() != f->GetNextInFlow()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns whether none of the frames of a left-to-right paragraph consisting
+// of a single directional run have ever been resolved to a different
+// direction, in which case resolving the paragraph wouldn't change anything.
+static bool
+IsUnchangedLTRParagraph(BidiParagraphData* aBpd)
+{
+  for (int32_t i = 0, count = aBpd->FrameCount(); i < count; ++i) {
+    nsIFrame* frame = aBpd->FrameAt(i);
+    if (frame == NS_BIDI_CONTROL_FRAME) {
+      return false;
+    }
+    FrameBidiData bidiData = frame->GetBidiData();
+    if (bidiData.embeddingLevel || bidiData.baseLevel ||
+        !HasOnlyFluidContinuations(frame)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 nsresult
 nsBidiPresUtils::ResolveParagraph(BidiParagraphData* aBpd)
 {
@@ -810,25 +846,27 @@ nsBidiPresUtils::ResolveParagraph(BidiParagraphData* aBpd)
 #endif
 #endif
 
-  if (runCount == 1 && frameCount == 1 &&
+  if (runCount == 1 &&
       aBpd->GetDirection() == NSBIDI_LTR && aBpd->GetParaLevel() == 0) {
-    // We have a single left-to-right frame in a left-to-right paragraph,
-    // without bidi isolation from the surrounding text.
-    // Make sure that the embedding level and base level frame properties aren't
-    // set (because if they are this frame used to have some other direction,
-    // so we can't do this optimization), and we're done.
-    nsIFrame* frame = aBpd->FrameAt(0);
-    if (frame != NS_BIDI_CONTROL_FRAME) {
-      FrameBidiData bidiData = frame->GetBidiData();
-      if (!bidiData.embeddingLevel && !bidiData.baseLevel) {
+    // We have a single left-to-right run in a left-to-right paragraph,
+    // without bidi isolation from the surrounding text; this is the common
+    // case for Latin text in a document that has some RTL text elsewhere.
+    // Make sure that the embedding level and base level frame properties
+    // aren't set and there are no bidi continuations (because if there are,
+    // the frames used to have some other direction, so we can't do this
+    // optimization), and we're done. This also avoids throwing away the
+    // text runs of all the frames in AdjustOffsetsForBidi.
+    if (IsUnchangedLTRParagraph(aBpd)) {
 #ifdef DEBUG
 #ifdef NOISY_BIDI
-        printf("early return for single direction frame %p\n", (void*)frame);
+      printf("early return for single direction paragraph with %d frames\n",
+             frameCount);
 #endif
 #endif
-        frame->AddStateBits(NS_FRAME_IS_BIDI);
-        return NS_OK;
+      for (int32_t i = 0; i < frameCount; ++i) {
+        aBpd->FrameAt(i)->AddStateBits(NS_FRAME_IS_BIDI);
       }
+      return NS_OK;
     }
   }
 
@@ -180,17 +180,21 @@ nsPresArena::AddSizeOfExcludingThis(nsWindowSizes& aSizes) const
   size_t mallocSize = mPool.SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
 
   size_t totalSizeInFreeLists = 0;
+  size_t totalSizeOfFreeEntries = 0;
   for (const FreeList* entry = mFreeLists;
        entry != ArrayEnd(mFreeLists);
        ++entry) {
     mallocSize += entry->SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
 
-    // Note that we're not measuring the size of the entries on the free
-    // list here.  The free list knows how many objects we've allocated
-    // ever (which includes any objects that may be on the FreeList's
-    // |mEntries| at this point) and we're using that to determine the
-    // total size of objects allocated with a given ID.
-    size_t totalSize = entry->mEntrySize * entry->mEntriesEverAllocated;
+    // The free list knows how many objects we've allocated ever, which
+    // includes the objects currently sitting in its |mEntries| waiting to be
+    // recycled.  Those are reported separately, so that the per-type numbers
+    // reflect only the objects that are actually live.
+    size_t freeSize = entry->mEntrySize * entry->mEntries.Length();
+    totalSizeOfFreeEntries += freeSize;
+
+    size_t totalSize =
+      entry->mEntrySize * entry->mEntriesEverAllocated - freeSize;
 
     switch (entry - mFreeLists) {
 #define FRAME_ID(classname, ...) \
@@ -226,5 +230,7 @@ nsPresArena::AddSizeOfExcludingThis(nsWindowSizes& aSizes) const
     totalSizeInFreeLists += totalSize;
   }
 
-  aSizes.mLayoutPresShellSize += mallocSize - totalSizeInFreeLists;
+  aSizes.mLayoutPresArenaFreeSize += totalSizeOfFreeEntries;
+  aSizes.mLayoutPresShellSize +=
+    mallocSize - totalSizeInFreeLists - totalSizeOfFreeEntries;
 }
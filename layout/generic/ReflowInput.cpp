@@ -416,6 +416,7 @@ ReflowInput::Init(nsPresContext*     aPresContext,
 
   InitFrameType(type);
   InitCBReflowInput();
+  InitDynamicReflowRoot();
 
   LogicalSize cbSize(mWritingMode, -1, -1);
   if (aContainingBlockSize) {
@@ -529,6 +530,84 @@ void ReflowInput::InitCBReflowInput()
   }
 }
 
+static bool
+IsFixedLength(const nsStyleCoord& aCoord)
+{
+  return aCoord.GetUnit() == eStyleUnit_Coord;
+}
+
+static bool
+IsFixedMinLength(const nsStyleCoord& aCoord)
+{
+  return aCoord.GetUnit() == eStyleUnit_Coord ||
+         aCoord.GetUnit() == eStyleUnit_Auto;
+}
+
+static bool
+IsFixedMaxLength(const nsStyleCoord& aCoord)
+{
+  return aCoord.GetUnit() == eStyleUnit_Coord ||
+         aCoord.GetUnit() == eStyleUnit_None;
+}
+
+// A block with 'contain: layout paint' (or 'strict') and a fixed size can't
+// be affected by changes in its subtree: its size comes from style alone,
+// layout containment keeps its baselines from being read off its lines and
+// makes it a formatting context for floats and positioned descendants, and
+// paint containment clips its overflow to its border box.  Such a block can
+// act as a reflow root, so that changes inside of it don't cause its
+// ancestors to be reflowed.  We only do this in block layout, where the
+// parent places the block independently of its content, and only when the
+// block has no margins and no visual overflow of its own, since PresShell
+// doesn't apply margins to reflow roots or propagate their overflow changes
+// to their ancestors.
+void
+ReflowInput::InitDynamicReflowRoot()
+{
+  // We're being reflowed as a reflow root, or by something that isn't our
+  // real parent; keep whatever we had.
+  if (!mParentReflowInput ||
+      mParentReflowInput->mFlags.mDummyParentReflowInput ||
+      !mFrame->IsBlockFrame()) {
+    return;
+  }
+
+  nsIFrame* parent = mFrame->GetParent();
+  nsMargin styleMargin;
+  bool canBeReflowRoot =
+    mStyleDisplay->IsContainLayout() &&
+    mStyleDisplay->IsContainPaint() &&
+    nsFrame::ShouldApplyOverflowClipping(mFrame, mStyleDisplay) &&
+    IsFixedLength(mStylePosition->mWidth) &&
+    mStylePosition->mWidth.GetCoordValue() > 0 &&
+    IsFixedLength(mStylePosition->mHeight) &&
+    mStylePosition->mHeight.GetCoordValue() > 0 &&
+    IsFixedMinLength(mStylePosition->mMinWidth) &&
+    IsFixedMinLength(mStylePosition->mMinHeight) &&
+    IsFixedMaxLength(mStylePosition->mMaxWidth) &&
+    IsFixedMaxLength(mStylePosition->mMaxHeight) &&
+    mStyleMargin->GetMargin(styleMargin) &&
+    styleMargin == nsMargin(0, 0, 0, 0) &&
+    !mStyleDisplay->mAppearance &&
+    !mStyleDisplay->HasTransformStyle() &&
+    !mFrame->StyleEffects()->mBoxShadow &&
+    !mFrame->StyleEffects()->HasFilters() &&
+    !mFrame->StyleOutline()->ShouldPaintOutline() &&
+    mStyleBorder->GetImageOutset() == nsMargin(0, 0, 0, 0) &&
+    !mFrame->GetPrevInFlow() && !mFrame->GetNextInFlow() &&
+    AvailableBSize() == NS_UNCONSTRAINEDSIZE &&
+    !mFrame->PresContext()->IsPaginated() &&
+    parent && parent->IsFrameOfType(nsIFrame::eBlockFrame) &&
+    parent->GetWritingMode() == mWritingMode;
+
+  if (canBeReflowRoot) {
+    mFrame->AddStateBits(NS_FRAME_REFLOW_ROOT | NS_BLOCK_DYNAMIC_REFLOW_ROOT);
+  } else if (mFrame->HasAnyStateBits(NS_BLOCK_DYNAMIC_REFLOW_ROOT)) {
+    mFrame->RemoveStateBits(NS_FRAME_REFLOW_ROOT |
+                            NS_BLOCK_DYNAMIC_REFLOW_ROOT);
+  }
+}
+
 /* Check whether CalcQuirkContainingBlockHeight would stop on the
  * given reflow state, using its block as a height.  (essentially
  * returns false for any case in which CalcQuirkContainingBlockHeight
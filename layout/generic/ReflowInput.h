@@ -974,6 +974,7 @@ public:
 protected:
   void InitFrameType(LayoutFrameType aFrameType);
   void InitCBReflowInput();
+  void InitDynamicReflowRoot();
   void InitResizeFlags(nsPresContext* aPresContext,
                        mozilla::LayoutFrameType aFrameType);
 
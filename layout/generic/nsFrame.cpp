@@ -6816,13 +6816,7 @@ nsIFrame::MovePositionBy(const nsPoint& aTranslation)
 nsRect
 nsIFrame::GetNormalRect() const
 {
-  // It might be faster to first check
-  // StyleDisplay()->IsRelativelyPositionedStyle().
-  nsPoint* normalPosition = GetProperty(NormalPositionProperty());
-  if (normalPosition) {
-    return nsRect(*normalPosition, GetSize());
-  }
-  return GetRect();
+  return nsRect(GetNormalPosition(), GetSize());
 }
 
 nsPoint
@@ -522,6 +522,11 @@ FRAME_STATE_BIT(Block, 29, NS_BLOCK_HAS_FIRST_LETTER_STYLE)
 FRAME_STATE_BIT(Block, 30, NS_BLOCK_FRAME_HAS_OUTSIDE_BULLET)
 FRAME_STATE_BIT(Block, 31, NS_BLOCK_FRAME_HAS_INSIDE_BULLET)
 
+// This block has NS_FRAME_REFLOW_ROOT set because its 'contain' style and
+// fixed size make it independent of its subtree; see
+// ReflowInput::InitDynamicReflowRoot.
+FRAME_STATE_BIT(Block, 60, NS_BLOCK_DYNAMIC_REFLOW_ROOT)
+
 // This block has had a child marked dirty, so before we reflow we need
 // to look through the lines to find any such children and mark
 // appropriate lines dirty.
@@ -3441,9 +3441,134 @@ nsGridContainerFrame::Tracks::Initialize(
 }
 
 /**
- * Reflow aChild in the given aAvailableSize.
+ * The result of a MeasuringReflow() of a grid item, stored on the item.
+ *
+ * Track sizing measures the same items over and over (for each track
+ * sizing step, and again for every reflow of an ancestor that doesn't
+ * affect them), which gets exponential with nested grids.  The measurement
+ * only depends on the inputs below as long as the item isn't dirty, so we
+ * reuse it until the item is dirtied or the grid container's intrinsic
+ * sizes are marked dirty (due to a style or DOM change).
+ *
+ * When we reuse a measurement the item isn't reflowed, so its frame state
+ * is whatever its last reflow left, which need not be this measurement.
+ * So besides the block-size we also keep every other value that callers
+ * read off the item after measuring it, and callers must use those.
  */
-static nscoord
+class nsGridContainerFrame::CachedBAxisMeasurement
+{
+  // Members that are part of the cache key:
+  const WritingMode mCBWM;
+  const LogicalSize mAvailableSize;
+  const LogicalSize mCBSize;
+  const nscoord mIMinSizeClamp;
+  const nscoord mBMinSizeClamp;
+
+  // Members that are part of the cache value:
+  const nscoord mBSize;
+  const nscoord mContentBSize;
+  const nsSize mSize;
+  const nsMargin mUsedMargin;
+  // The item's first and last baselines in the grid container's writing
+  // mode, indexed by BaselineSharingGroup, or NS_INTRINSIC_WIDTH_UNKNOWN.
+  // A grid container item has baselines in both of its axes, indexed by
+  // LogicalAxis; other items only use the eLogicalAxisBlock entries.
+  nscoord mBaseline[2][2];
+  bool mHasBaseline[2];
+  const bool mIsGridContainer;
+
+public:
+  CachedBAxisMeasurement(const nsIFrame* aChild,
+                         WritingMode aCBWM,
+                         const LogicalSize& aAvailableSize,
+                         const LogicalSize& aCBSize,
+                         nscoord aIMinSizeClamp,
+                         nscoord aBMinSizeClamp,
+                         nscoord aBSize)
+    : mCBWM(aCBWM)
+    , mAvailableSize(aAvailableSize)
+    , mCBSize(aCBSize)
+    , mIMinSizeClamp(aIMinSizeClamp)
+    , mBMinSizeClamp(aBMinSizeClamp)
+    , mBSize(aBSize)
+    , mContentBSize(aChild->ContentBSize(aChild->GetWritingMode()))
+    , mSize(aChild->GetSize())
+    , mUsedMargin(aChild->GetUsedMargin())
+    , mIsGridContainer(aChild->IsGridContainerFrame())
+  {
+    for (auto group : { BaselineSharingGroup::eFirst,
+                        BaselineSharingGroup::eLast }) {
+      nscoord& bBaseline = mBaseline[eLogicalAxisBlock][group];
+      nscoord& iBaseline = mBaseline[eLogicalAxisInline][group];
+      bBaseline = iBaseline = NS_INTRINSIC_WIDTH_UNKNOWN;
+      if (mIsGridContainer) {
+        auto* grid = static_cast<const nsGridContainerFrame*>(aChild);
+        grid->GetBBaseline(group, &bBaseline);
+        grid->GetIBaseline(group, &iBaseline);
+        mHasBaseline[group] = true;
+      } else if (group == BaselineSharingGroup::eFirst) {
+        mHasBaseline[group] =
+          nsLayoutUtils::GetFirstLineBaseline(aCBWM, aChild, &bBaseline);
+      } else {
+        mHasBaseline[group] =
+          nsLayoutUtils::GetLastLineBaseline(aCBWM, aChild, &bBaseline);
+      }
+    }
+  }
+
+  bool IsValidFor(WritingMode aCBWM,
+                  const LogicalSize& aAvailableSize,
+                  const LogicalSize& aCBSize,
+                  nscoord aIMinSizeClamp,
+                  nscoord aBMinSizeClamp) const
+  {
+    // The baselines are in the grid container's writing mode.
+    return mCBWM == aCBWM &&
+           mAvailableSize == aAvailableSize && mCBSize == aCBSize &&
+           mIMinSizeClamp == aIMinSizeClamp &&
+           mBMinSizeClamp == aBMinSizeClamp;
+  }
+
+  /** The item's block-size, in its own writing mode. */
+  nscoord BSize() const { return mBSize; }
+
+  /** The item's content-box block-size, in its own writing mode. */
+  nscoord ContentBSize() const { return mContentBSize; }
+
+  LogicalSize Size(WritingMode aWM) const { return LogicalSize(aWM, mSize); }
+
+  LogicalMargin UsedMargin(WritingMode aWM) const
+  {
+    return LogicalMargin(aWM, mUsedMargin);
+  }
+
+  /**
+   * Return true if the item has a baseline in aGroup, and if so return it in
+   * aResult, like GetBBaseline/GetIBaseline or GetFirst/LastLineBaseline
+   * would have right after the measuring reflow.  aItemAxis selects between
+   * the former two for grid container items, and is ignored otherwise.
+   */
+  bool GetBaseline(LogicalAxis aItemAxis,
+                   BaselineSharingGroup aGroup,
+                   nscoord* aResult) const
+  {
+    if (!mHasBaseline[aGroup]) {
+      return false;
+    }
+    *aResult = mBaseline[mIsGridContainer ? aItemAxis : eLogicalAxisBlock][aGroup];
+    return true;
+  }
+
+  NS_DECLARE_FRAME_PROPERTY_DELETABLE(Prop, CachedBAxisMeasurement)
+};
+using CachedBAxisMeasurement = nsGridContainerFrame::CachedBAxisMeasurement;
+
+/**
+ * Reflow aChild in the given aAvailableSize, or reuse the result of an
+ * earlier such reflow.  Callers must read the item's size, margin and
+ * baselines from the returned measurement rather than from the item.
+ */
+static const CachedBAxisMeasurement&
 MeasuringReflow(nsIFrame*           aChild,
                 const ReflowInput*  aReflowInput,
                 gfxContext*         aRC,
@@ -3484,6 +3609,22 @@ MeasuringReflow(nsIFrame*           aChild,
   } else {
     aChild->DeleteProperty(nsIFrame::BClampMarginBoxMinSizeProperty());
   }
+
+  if (!NS_SUBTREE_DIRTY(aChild)) {
+    if (const auto* cachedResult =
+          aChild->GetProperty(CachedBAxisMeasurement::Prop())) {
+      if (cachedResult->IsValidFor(parent->GetWritingMode(),
+                                   aAvailableSize, aCBSize,
+                                   aIMinSizeClamp, aBMinSizeClamp)) {
+#ifdef DEBUG
+        parent->DeleteProperty(
+          nsContainerFrame::DebugReflowingWithInfiniteISize());
+#endif
+        return *cachedResult;
+      }
+    }
+  }
+
   ReflowInput childRI(pc, *rs, aChild, aAvailableSize, &aCBSize, riFlags);
 
   // Because we pass ReflowInput::COMPUTE_SIZE_USE_AUTO_BSIZE, and the
@@ -3505,7 +3646,12 @@ MeasuringReflow(nsIFrame*           aChild,
 #ifdef DEBUG
     parent->DeleteProperty(nsContainerFrame::DebugReflowingWithInfiniteISize());
 #endif
-  return childSize.BSize(wm);
+  auto* result = new CachedBAxisMeasurement(aChild, parent->GetWritingMode(),
+                                            aAvailableSize, aCBSize,
+                                            aIMinSizeClamp, aBMinSizeClamp,
+                                            childSize.BSize(wm));
+  aChild->SetProperty(CachedBAxisMeasurement::Prop(), result);
+  return *result;
 }
 
 /**
@@ -3563,8 +3709,10 @@ ContentContribution(const GridItemInfo&       aGridItem,
       iMinSizeClamp = aMinSizeClamp;
     }
     LogicalSize availableSize(childWM, availISize, availBSize);
-    size = ::MeasuringReflow(child, aState.mReflowInput, aRC, availableSize,
-                             cbSize, iMinSizeClamp, bMinSizeClamp);
+    const CachedBAxisMeasurement& measurement =
+      ::MeasuringReflow(child, aState.mReflowInput, aRC, availableSize,
+                        cbSize, iMinSizeClamp, bMinSizeClamp);
+    size = measurement.BSize();
     nsIFrame::IntrinsicISizeOffsetData offsets = child->IntrinsicBSizeOffsets();
     size += offsets.hMargin;
     auto percent = offsets.hPctMargin;
@@ -3576,7 +3724,7 @@ ContentContribution(const GridItemInfo&       aGridItem,
     size = nsLayoutUtils::AddPercents(size, percent);
     nscoord overflow = size - aMinSizeClamp;
     if (MOZ_UNLIKELY(overflow > 0)) {
-      nscoord contentSize = child->ContentBSize(childWM);
+      nscoord contentSize = measurement.ContentBSize();
       nscoord newContentSize = std::max(nscoord(0), contentSize - overflow);
       // XXXmats deal with percentages better, see bug 1300369 comment 27.
       size -= contentSize - newContentSize;
@@ -4010,52 +4158,39 @@ nsGridContainerFrame::Tracks::InitializeItemBaselines(
       // XXX Maybe we should just call ::ContentContribution here instead?
       // XXX For now we just pass a zero-sized CB:
       LogicalSize cbSize(childWM, 0, 0);
-      ::MeasuringReflow(child, aState.mReflowInput, rc, avail, cbSize);
+      const CachedBAxisMeasurement& measurement =
+        ::MeasuringReflow(child, aState.mReflowInput, rc, avail, cbSize);
+      // The item's axis that the baseline is perpendicular to, for grid
+      // container items (see nsGridContainerFrame::GetBBaseline).
+      const LogicalAxis itemBaselineAxis =
+        isOrthogonal == isInlineAxis ? eLogicalAxisBlock : eLogicalAxisInline;
+      const auto frameSize = isInlineAxis ? measurement.Size(wm).ISize(wm)
+                                          : measurement.Size(wm).BSize(wm);
+      const auto m = measurement.UsedMargin(wm);
+      const auto alignSize = frameSize + (isInlineAxis ? m.IStartEnd(wm)
+                                                       : m.BStartEnd(wm));
       nscoord baseline;
-      nsGridContainerFrame* grid = do_QueryFrame(child);
       if (state & ItemState::eFirstBaseline) {
-        if (grid) {
-          if (isOrthogonal == isInlineAxis) {
-            grid->GetBBaseline(BaselineSharingGroup::eFirst, &baseline);
-          } else {
-            grid->GetIBaseline(BaselineSharingGroup::eFirst, &baseline);
-          }
-        }
-        if (grid ||
-            nsLayoutUtils::GetFirstLineBaseline(wm, child, &baseline)) {
+        if (measurement.GetBaseline(itemBaselineAxis,
+                                    BaselineSharingGroup::eFirst, &baseline)) {
           NS_ASSERTION(baseline != NS_INTRINSIC_WIDTH_UNKNOWN,
                        "about to use an unknown baseline");
-          auto frameSize = isInlineAxis ? child->ISize(wm) : child->BSize(wm);
-          auto m = child->GetLogicalUsedMargin(wm);
           baseline += isInlineAxis ? m.IStart(wm) : m.BStart(wm);
-          auto alignSize = frameSize + (isInlineAxis ? m.IStartEnd(wm)
-                                                     : m.BStartEnd(wm));
           firstBaselineItems.AppendElement(ItemBaselineData(
             { baselineTrack, baseline, alignSize, &gridItem }));
         } else {
           state &= ~ItemState::eAllBaselineBits;
         }
       } else {
-        if (grid) {
-          if (isOrthogonal == isInlineAxis) {
-            grid->GetBBaseline(BaselineSharingGroup::eLast, &baseline);
-          } else {
-            grid->GetIBaseline(BaselineSharingGroup::eLast, &baseline);
-          }
-        }
-        if (grid ||
-            nsLayoutUtils::GetLastLineBaseline(wm, child, &baseline)) {
+        if (measurement.GetBaseline(itemBaselineAxis,
+                                    BaselineSharingGroup::eLast, &baseline)) {
           NS_ASSERTION(baseline != NS_INTRINSIC_WIDTH_UNKNOWN,
                        "about to use an unknown baseline");
-          auto frameSize = isInlineAxis ? child->ISize(wm) : child->BSize(wm);
-          auto m = child->GetLogicalUsedMargin(wm);
-          if (!grid) {
+          if (!child->IsGridContainerFrame()) {
             // Convert to distance from border-box end.
             baseline = frameSize - baseline;
           }
           auto descent = baseline + (isInlineAxis ? m.IEnd(wm) : m.BEnd(wm));
-          auto alignSize = frameSize + (isInlineAxis ? m.IStartEnd(wm)
-                                                     : m.BStartEnd(wm));
           lastBaselineItems.AppendElement(ItemBaselineData(
             { baselineTrack, descent, alignSize, &gridItem }));
         } else {
@@ -6402,6 +6537,11 @@ nsGridContainerFrame::MarkIntrinsicISizesDirty()
   mBaseline[0][1] = NS_INTRINSIC_WIDTH_UNKNOWN;
   mBaseline[1][0] = NS_INTRINSIC_WIDTH_UNKNOWN;
   mBaseline[1][1] = NS_INTRINSIC_WIDTH_UNKNOWN;
+  for (ChildListIterator lists(this); !lists.IsDone(); lists.Next()) {
+    for (nsIFrame* child : lists.CurrentList()) {
+      child->DeleteProperty(CachedBAxisMeasurement::Prop());
+    }
+  }
   nsContainerFrame::MarkIntrinsicISizesDirty();
 }
 
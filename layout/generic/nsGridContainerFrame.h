@@ -224,6 +224,7 @@ public:
   struct TrackSize;
   struct GridItemInfo;
   struct GridReflowInput;
+  class CachedBAxisMeasurement;
   struct FindItemInGridOrderResult
   {
     // The first(last) item in (reverse) grid order.
@@ -4744,7 +4744,12 @@ nsIFrame::IsFrameListSorted(nsFrameList& aFrameList)
 nsPoint
 nsIFrame::GetNormalPosition(bool* aHasProperty) const
 {
-  nsPoint* normalPosition = GetProperty(NormalPositionProperty());
+  // The normal position is only ever stored for relatively positioned
+  // frames, so skip the property lookup, which is a linear search, for all
+  // other frames.
+  nsPoint* normalPosition =
+    StyleDisplay()->IsRelativelyPositionedStyle()
+      ? GetProperty(NormalPositionProperty()) : nullptr;
   if (normalPosition) {
     if (aHasProperty) {
       *aHasProperty = true;
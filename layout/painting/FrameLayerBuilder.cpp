@@ -3976,6 +3976,11 @@ ContainerState::ProcessDisplayItems(nsDisplayList* aList)
   const ActiveScrolledRoot* lastASR = mContainerASR;
   nsPoint lastAGRTopLeft;
   nsPoint topLeft(0,0);
+  // Consecutive items very often share an animated geometry root, so cache
+  // its offset to the container reference frame rather than walking up the
+  // frame tree again for every item.
+  AnimatedGeometryRoot* cachedAGR = nullptr;
+  nsPoint cachedAGRTopLeft;
 
   // When NO_COMPONENT_ALPHA is set, items will be flattened into a single
   // layer, so we need to choose which active scrolled root to use for all
@@ -4078,7 +4083,12 @@ ContainerState::ProcessDisplayItems(nsDisplayList* aList)
         itemASR = mContainerASR;
         item->FuseClipChainUpTo(mBuilder, mContainerASR);
       }
-      topLeft = (*animatedGeometryRoot)->GetOffsetToCrossDoc(mContainerReferenceFrame);
+      if (animatedGeometryRoot != cachedAGR) {
+        cachedAGR = animatedGeometryRoot;
+        cachedAGRTopLeft =
+          (*animatedGeometryRoot)->GetOffsetToCrossDoc(mContainerReferenceFrame);
+      }
+      topLeft = cachedAGRTopLeft;
     }
 
     const ActiveScrolledRoot* scrollMetadataASR =
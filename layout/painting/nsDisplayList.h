@@ -2412,6 +2412,13 @@ public:
    */
   template<typename Item, typename Comparator>
   void Sort(const Comparator& aComparator) {
+    // Lists with zero or one items are trivially sorted. They are by far the
+    // most common case for the per-stacking-context lists we sort here, so
+    // avoid unlinking and relinking their items.
+    if (IsEmpty() || mSentinel.mAbove == mTop) {
+      return;
+    }
+
     // Some casual local browsing testing suggests that a local preallocated
     // array of 20 items should be able to avoid a lot of dynamic allocations
     // here.
@@ -1140,10 +1140,30 @@ Loader::CreateSheet(nsIURI* aURI,
       LOG(("  From completed: %p", sheet.get()));
 
       fromCompleteSheets = !!sheet;
+
+      // Then the complete sheets of our ancestor documents, so that
+      // same-origin subdocuments share the parsed contents of the sheets
+      // already loaded by the documents embedding them.  Sheets loaded with
+      // integrity metadata always go through their own load, so that the
+      // integrity check is done against the subdocument's request.
+      nsIDocument* ancestor =
+        mDocument && aIntegrity.IsEmpty() ? mDocument->GetParentDocument()
+                                          : nullptr;
+      for (nsIDocument* doc = ancestor; doc && !sheet;
+           doc = doc->GetParentDocument()) {
+        Loader* loader = doc->CSSLoader();
+        if (!loader || !loader->mSheets ||
+            loader->GetStyleBackendType() != GetStyleBackendType()) {
+          continue;
+        }
+        loader->mSheets->mCompleteSheets.Get(&key, &completeSheet);
+        sheet = completeSheet;
+        LOG(("  From ancestor document: %p", sheet.get()));
+      }
     }
 
     if (sheet) {
-      // This sheet came from the XUL cache or our per-document hashtable; it
+      // This sheet came from the XUL cache or a per-document hashtable; it
       // better be a complete sheet.
       NS_ASSERTION(sheet->IsComplete(),
                    "Sheet thinks it's not complete while we think it is");
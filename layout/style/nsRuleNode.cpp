@@ -6455,7 +6455,7 @@ nsRuleNode::ComputeDisplayData(void* aStartStruct,
       // mOriginalDisplay, which we have carefully not changed.
     }
 
-    if (display->IsContainPaint()) {
+    if (display->IsContainPaint() || display->IsContainLayout()) {
       // An element with contain:paint or contain:layout needs to "be a
       // formatting context". For the purposes of the "display" property, that
       // just means we need to promote "display:inline" to "inline-block".
@@ -2874,6 +2874,10 @@ struct MOZ_NEEDS_MEMMOVABLE_MEMBERS nsStyleDisplay
     return NS_STYLE_CONTAIN_PAINT & mContain;
   }
 
+  bool IsContainLayout() const {
+    return NS_STYLE_CONTAIN_LAYOUT & mContain;
+  }
+
   /* Returns whether the element has the -moz-transform property
    * or a related property. */
   bool HasTransformStyle() const {
@@ -156,7 +156,7 @@ nsStyleDisplay::HasFixedPosContainingBlockStyleInternal(
   NS_ASSERTION(aStyleContext->ThreadsafeStyleDisplay() == this,
                "unexpected aStyleContext");
 
-  if (IsContainPaint() || HasPerspectiveStyle()) {
+  if (IsContainPaint() || IsContainLayout() || HasPerspectiveStyle()) {
     return true;
   }
 
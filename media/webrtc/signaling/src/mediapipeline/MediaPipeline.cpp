@@ -51,6 +51,7 @@
 
 #include "webrtc/common_types.h"
 #include "webrtc/common_video/libyuv/include/webrtc_libyuv.h"
+#include "webrtc/common_video/include/i420_buffer_pool.h"
 #include "webrtc/common_video/include/video_frame_buffer.h"
 #include "webrtc/base/bind.h"
 
@@ -234,54 +235,44 @@ protected:
     MOZ_COUNT_DTOR(VideoFrameConverter);
   }
 
-  static void DeleteBuffer(uint8 *data)
+  void VideoFrameConverted(webrtc::VideoFrame& aVideoFrame)
   {
-    delete[] data;
+    MutexAutoLock lock(mMutex);
+
+    for (RefPtr<VideoConverterListener>& listener : mListeners) {
+      listener->OnVideoFrameConverted(aVideoFrame);
+    }
   }
 
-  // This takes ownership of the buffer and attached it to the VideoFrame we send
-  // to the listeners
-  void VideoFrameConverted(UniquePtr<uint8[]> aBuffer,
-                           unsigned int aVideoFrameLength,
-                           unsigned short aWidth,
-                           unsigned short aHeight,
-                           VideoType aVideoType,
-                           uint64_t aCaptureTime)
+  // I420Buffer asserts on an empty frame, and I420SIZE catches dimensions
+  // whose planes would overflow.
+  static bool IsValidFrameSize(const IntSize& aSize)
   {
     // check for parameter sanity
-    if (!aBuffer || aVideoFrameLength == 0 || aWidth == 0 || aHeight == 0) {
+    if (aSize.width <= 0 || aSize.height <= 0) {
       MOZ_MTLOG(ML_ERROR, __FUNCTION__ << " Invalid Parameters ");
       MOZ_ASSERT(false);
-      return;
+      return false;
     }
-    MOZ_ASSERT(aVideoType == VideoType::kVideoI420);
-
-    const int stride_y = aWidth;
-    const int stride_uv = (aWidth + 1) / 2;
-
-    const uint8_t* buffer_y = aBuffer.get();
-    const uint8_t* buffer_u = buffer_y + stride_y * aHeight;
-    const uint8_t* buffer_v = buffer_u + stride_uv * ((aHeight + 1) / 2);
-    rtc::scoped_refptr<webrtc::WrappedI420Buffer> video_frame_buffer(
-      new rtc::RefCountedObject<webrtc::WrappedI420Buffer>(
-        aWidth, aHeight,
-        buffer_y, stride_y,
-        buffer_u, stride_uv,
-        buffer_v, stride_uv,
-        rtc::Bind(&DeleteBuffer, aBuffer.release())));
-
-    webrtc::VideoFrame video_frame(video_frame_buffer, aCaptureTime,
-                                   aCaptureTime, webrtc::kVideoRotation_0); // XXX
-    VideoFrameConverted(video_frame);
+    return I420SIZE(aSize.width, aSize.height).isValid();
   }
 
-  void VideoFrameConverted(webrtc::VideoFrame& aVideoFrame)
+  // Returns null if the pool is exhausted or the planes couldn't be
+  // allocated; the pool's buffers are AlignedMalloc'ed, which returns null on
+  // OOM. A buffer without planes would otherwise stay in the pool and be
+  // handed out again for every frame of this size, so drop the pool's
+  // buffers and let the next frame retry.
+  rtc::scoped_refptr<webrtc::I420Buffer> CreateBuffer(const IntSize& aSize)
   {
-    MutexAutoLock lock(mMutex);
-
-    for (RefPtr<VideoConverterListener>& listener : mListeners) {
-      listener->OnVideoFrameConverted(aVideoFrame);
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      mBufferPool.CreateBuffer(aSize.width, aSize.height);
+    if (buffer && !buffer->MutableDataY()) {
+      MOZ_MTLOG(ML_ERROR, "Allocating a " << aSize.width << "x"
+                          << aSize.height << " I420 buffer failed");
+      mBufferPool.Release();
+      return nullptr;
     }
+    return buffer;
   }
 
   void ProcessVideoFrame(Image* aImage, bool aForceBlack)
@@ -291,27 +282,25 @@ protected:
 
     if (aForceBlack) {
       IntSize size = aImage->GetSize();
-      CheckedInt<int> yPlaneLen = YSIZE(size.width, size.height);
-      // doesn't need to be CheckedInt, any overflow will be caught by YSIZE
-      int cbcrPlaneLen = 2 * CRSIZE(size.width, size.height);
-      CheckedInt<int> length = yPlaneLen + cbcrPlaneLen;
-
-      if (!yPlaneLen.isValid() || !length.isValid()) {
+      if (!IsValidFrameSize(size)) {
         return;
       }
 
       // Send a black image.
-      auto pixelData = MakeUniqueFallible<uint8_t[]>(length.value());
-      if (pixelData) {
+      rtc::scoped_refptr<webrtc::I420Buffer> buffer = CreateBuffer(size);
+      if (buffer) {
         // YCrCb black = 0x10 0x80 0x80
-        memset(pixelData.get(), 0x10, yPlaneLen.value());
+        int cHeight = (size.height + 1) >> 1;
+        memset(buffer->MutableDataY(), 0x10, buffer->StrideY() * size.height);
         // Fill Cb/Cr planes
-        memset(pixelData.get() + yPlaneLen.value(), 0x80, cbcrPlaneLen);
+        memset(buffer->MutableDataU(), 0x80, buffer->StrideU() * cHeight);
+        memset(buffer->MutableDataV(), 0x80, buffer->StrideV() * cHeight);
 
+        webrtc::VideoFrame frame(buffer,
+                                 0, 0, // not setting timestamps
+                                 webrtc::kVideoRotation_0);
         MOZ_MTLOG(ML_DEBUG, "Sending a black video frame");
-        VideoFrameConverted(Move(pixelData), length.value(),
-                            size.width, size.height,
-                            mozilla::kVideoI420, 0);
+        VideoFrameConverted(frame);
       }
       return;
     }
@@ -365,21 +354,14 @@ protected:
     }
 
     IntSize size = aImage->GetSize();
-    // these don't need to be CheckedInt, any overflow will be caught by YSIZE
-    int half_width = (size.width + 1) >> 1;
-    int half_height = (size.height + 1) >> 1;
-    int c_size = half_width * half_height;
-    CheckedInt<int> buffer_size = YSIZE(size.width, size.height) + 2 * c_size;
-
-    if (!buffer_size.isValid()) {
+    if (!IsValidFrameSize(size)) {
       return;
     }
 
-    auto yuv_scoped = MakeUniqueFallible<uint8[]>(buffer_size.value());
-    if (!yuv_scoped) {
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer = CreateBuffer(size);
+    if (!buffer) {
       return;
     }
-    uint8* yuv = yuv_scoped.get();
 
     DataSourceSurface::ScopedMap map(data, DataSourceSurface::READ);
     if (!map.IsMapped()) {
@@ -390,24 +372,22 @@ protected:
     }
 
     int rv;
-    int cb_offset = YSIZE(size.width, size.height).value();
-    int cr_offset = cb_offset + c_size;
     switch (surf->GetFormat()) {
       case SurfaceFormat::B8G8R8A8:
       case SurfaceFormat::B8G8R8X8:
         rv = libyuv::ARGBToI420(static_cast<uint8*>(map.GetData()),
                                 map.GetStride(),
-                                yuv, size.width,
-                                yuv + cb_offset, half_width,
-                                yuv + cr_offset, half_width,
+                                buffer->MutableDataY(), buffer->StrideY(),
+                                buffer->MutableDataU(), buffer->StrideU(),
+                                buffer->MutableDataV(), buffer->StrideV(),
                                 size.width, size.height);
         break;
       case SurfaceFormat::R5G6B5_UINT16:
         rv = libyuv::RGB565ToI420(static_cast<uint8*>(map.GetData()),
                                   map.GetStride(),
-                                  yuv, size.width,
-                                  yuv + cb_offset, half_width,
-                                  yuv + cr_offset, half_width,
+                                  buffer->MutableDataY(), buffer->StrideY(),
+                                  buffer->MutableDataU(), buffer->StrideU(),
+                                  buffer->MutableDataV(), buffer->StrideV(),
                                   size.width, size.height);
         break;
       default:
@@ -421,12 +401,20 @@ protected:
     }
     MOZ_MTLOG(ML_DEBUG, "Sending an I420 video frame converted from " <<
                         Stringify(surf->GetFormat()));
-    VideoFrameConverted(Move(yuv_scoped), buffer_size.value(), size.width, size.height, mozilla::kVideoI420, 0);
+    webrtc::VideoFrame frame(buffer,
+                             0, 0, // not setting timestamps
+                             webrtc::kVideoRotation_0);
+    VideoFrameConverted(frame);
   }
 
   Atomic<int32_t, Relaxed> mLength;
   RefPtr<TaskQueue> mTaskQueue;
 
+  // Only used on mTaskQueue. Buffers return to the pool once all listeners
+  // have released the frames built on them, so steady-state conversion
+  // doesn't allocate.
+  webrtc::I420BufferPool mBufferPool;
+
   // Written and read from the queueing thread (normally MSG).
   int32_t last_img_; // serial number of last Image
   TimeStamp disabled_frame_sent_; // The time we sent the last disabled frame.
@@ -62,6 +62,11 @@ MALLOC_DECL_VOID(jemalloc_stats, jemalloc_stats_t *)
 MALLOC_DECL_VOID(jemalloc_purge_freed_pages)
 MALLOC_DECL_VOID(jemalloc_free_dirty_pages)
 MALLOC_DECL_VOID(jemalloc_thread_local_arena, jemalloc_bool)
+MALLOC_DECL(moz_create_arena, arena_id_t)
+MALLOC_DECL(moz_arena_malloc, void *, arena_id_t, size_t)
+MALLOC_DECL(moz_arena_calloc, void *, arena_id_t, size_t, size_t)
+MALLOC_DECL(moz_arena_realloc, void *, arena_id_t, void *, size_t)
+MALLOC_DECL_VOID(moz_arena_free, arena_id_t, void *)
 #  endif
 
 #  undef MALLOC_DECL_VOID
@@ -13,6 +13,7 @@
  *   - jemalloc_purge_freed_pages
  *   - jemalloc_free_dirty_pages
  *   - jemalloc_thread_local_arena
+ *   - moz_create_arena and the moz_arena_* functions
  */
 
 #ifndef MOZ_MEMORY
@@ -87,4 +88,30 @@ MOZ_JEMALLOC_API void jemalloc_free_dirty_pages();
 
 MOZ_JEMALLOC_API void jemalloc_thread_local_arena(jemalloc_bool enabled);
 
+/*
+ * Create a private arena.  Memory allocated with moz_arena_malloc() and
+ * friends from that arena is kept apart from the arenas backing malloc(),
+ * so that a subsystem with a distinct allocation lifetime does not fragment
+ * the general heap.  Private arenas live until shutdown.  Returns 0 if the
+ * arena can't be created; the default arena is never handed out instead.
+ *
+ * Private arenas are included in the jemalloc_stats() totals, and so in
+ * about:memory's heap-* reports, but are not broken out per arena yet.
+ *
+ * Memory allocated from a private arena must be released with
+ * moz_arena_free() or resized with moz_arena_realloc(), passing the same
+ * arena.
+ */
+MOZ_JEMALLOC_API arena_id_t moz_create_arena();
+
+MOZ_JEMALLOC_API void* moz_arena_malloc(arena_id_t arena, size_t size);
+
+MOZ_JEMALLOC_API void* moz_arena_calloc(arena_id_t arena, size_t num,
+                                        size_t size);
+
+MOZ_JEMALLOC_API void* moz_arena_realloc(arena_id_t arena, void* ptr,
+                                         size_t size);
+
+MOZ_JEMALLOC_API void moz_arena_free(arena_id_t arena, void* ptr);
+
 #endif /* mozmemory_h */
@@ -86,7 +86,7 @@ typedef struct {
  * other allocation functions, like calloc_hook.
  */
 #define MALLOC_DECL(name, return_type, ...) \
-  return_type (*name ## _hook)(return_type, __VA_ARGS__);
+  return_type (*name ## _hook)(return_type, ##__VA_ARGS__);
 #define MALLOC_DECL_VOID(name, ...) \
   void (*name ## _hook)(__VA_ARGS__);
 
@@ -119,7 +119,7 @@ struct DebugFdRegistry
 
 struct ReplaceMallocBridge
 {
-  ReplaceMallocBridge() : mVersion(3) {}
+  ReplaceMallocBridge() : mVersion(4) {}
 
   /* This method was added in version 1 of the bridge. */
   virtual mozilla::dmd::DMDFuncs* GetDMDFuncs() { return nullptr; }
@@ -142,7 +142,10 @@ struct ReplaceMallocBridge
    * /!\ Do not rely on registration/unregistration to be instantaneous.
    * Functions from a previously registered table may still be called for
    * a brief time after RegisterHook returns.
-   * This method was added in version 3 of the bridge. */
+   * This method was added in version 3 of the bridge. The layout of both
+   * tables changed in version 4, when the moz_create_arena and moz_arena_*
+   * functions were added to malloc_decls.h, so it is only called on
+   * version 4 bridges. */
   virtual const malloc_table_t*
   RegisterHook(const char* aName, const malloc_table_t* aTable,
                const malloc_hook_table_t* aHookTable) { return nullptr; }
@@ -190,7 +193,7 @@ struct ReplaceMalloc
   RegisterHook(const char* aName, const malloc_table_t* aTable,
                const malloc_hook_table_t* aHookTable)
   {
-    auto singleton = ReplaceMallocBridge::Get(/* minimumVersion */ 3);
+    auto singleton = ReplaceMallocBridge::Get(/* minimumVersion */ 4);
     return singleton ? singleton->RegisterHook(aName, aTable, aHookTable)
                      : nullptr;
   }
@@ -49,3 +49,65 @@ TEST(Jemalloc, UsableSizeInAdvance)
   for (size_t n = 1 M; n < 8 M; n += 128 K)
     ASSERT_NO_FATAL_FAILURE(TestThree(n));
 }
+
+static inline uintptr_t
+ChunkOf(void* aPtr, size_t aChunkSize)
+{
+  return uintptr_t(aPtr) & ~(uintptr_t(aChunkSize) - 1);
+}
+
+TEST(Jemalloc, PrivateArena)
+{
+  jemalloc_stats_t stats;
+  jemalloc_stats(&stats);
+
+  arena_id_t arena = moz_create_arena();
+  ASSERT_NE(arena, arena_id_t(0));
+  ASSERT_NE(arena, moz_create_arena());
+
+  // Small and large allocations come from the private arena's own chunks,
+  // never from a chunk shared with malloc().
+  const size_t sizes[] = { 1, 16, 1024, 4096, 64 * 1024 };
+  for (size_t size : sizes) {
+    void* general = malloc(size);
+    void* priv = moz_arena_malloc(arena, size);
+    ASSERT_TRUE(general);
+    ASSERT_TRUE(priv);
+    EXPECT_NE(ChunkOf(general, stats.chunksize), ChunkOf(priv, stats.chunksize))
+      << "size " << size;
+    EXPECT_LE(size, moz_malloc_usable_size(priv));
+    free(general);
+    moz_arena_free(arena, priv);
+  }
+
+  // Huge allocations aren't arena-specific, but must still round-trip.
+  void* huge = moz_arena_malloc(arena, 2 * stats.chunksize);
+  ASSERT_TRUE(huge);
+  moz_arena_free(arena, huge);
+
+  unsigned char* zeroed = (unsigned char*)moz_arena_calloc(arena, 16, 64);
+  ASSERT_TRUE(zeroed);
+  for (size_t i = 0; i < 16 * 64; i++) {
+    EXPECT_EQ(0, zeroed[i]);
+  }
+  moz_arena_free(arena, zeroed);
+
+  EXPECT_FALSE(moz_arena_calloc(arena, SIZE_MAX / 2, 4));
+
+  // A realloc that has to move stays in the private arena and keeps the data.
+  char* ptr = (char*)moz_arena_realloc(arena, nullptr, 32);
+  ASSERT_TRUE(ptr);
+  memset(ptr, 'x', 32);
+  void* general = malloc(8 * 1024);
+  ptr = (char*)moz_arena_realloc(arena, ptr, 8 * 1024);
+  ASSERT_TRUE(ptr);
+  EXPECT_NE(ChunkOf(general, stats.chunksize), ChunkOf(ptr, stats.chunksize));
+  for (size_t i = 0; i < 32; i++) {
+    EXPECT_EQ('x', ptr[i]);
+  }
+  free(general);
+  moz_arena_free(arena, ptr);
+
+  // Freeing nullptr is fine, as for free().
+  moz_arena_free(arena, nullptr);
+}
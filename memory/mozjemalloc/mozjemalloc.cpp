@@ -995,7 +995,7 @@ static size_t	opt_chunk_2pow = CHUNK_2POW_DEFAULT;
 static void	*chunk_alloc(size_t size, size_t alignment, bool base, bool *zeroed=nullptr);
 static void	chunk_dealloc(void *chunk, size_t size, ChunkType chunk_type);
 static void	chunk_ensure_zero(void* ptr, size_t size, bool zeroed);
-static arena_t	*arenas_extend();
+static arena_t	*arenas_extend(bool fallback);
 static void	*huge_malloc(size_t size, bool zero);
 static void	*huge_palloc(size_t size, size_t alignment, bool zero);
 static void	*huge_ralloc(void *ptr, size_t size, size_t oldsize);
@@ -2223,7 +2223,7 @@ thread_local_arena(bool enabled)
 		 * called with `false`, but it doesn't matter at the moment.
 		 * because in practice nothing actually calls this function
 		 * with `false`, except maybe at shutdown. */
-		arena = arenas_extend();
+		arena = arenas_extend(true);
 	} else {
 		malloc_spin_lock(&arenas_lock);
 		arena = arenas[0];
@@ -3785,7 +3785,7 @@ arena_ralloc_large(void *ptr, size_t size, size_t oldsize)
 }
 
 static void *
-arena_ralloc(void *ptr, size_t size, size_t oldsize)
+arena_ralloc(void *ptr, size_t size, size_t oldsize, arena_t *arena)
 {
 	void *ret;
 	size_t copysize;
@@ -3814,9 +3814,10 @@ arena_ralloc(void *ptr, size_t size, size_t oldsize)
 	/*
 	 * If we get here, then size and oldsize are different enough that we
 	 * need to move the object.  In that case, fall back to allocating new
-	 * space and copying.
+	 * space and copying.  Unless the caller asked for a specific arena, the
+	 * new space comes from the current thread's arena.
 	 */
-	ret = arena_malloc(choose_arena(), size, false);
+	ret = arena_malloc(arena ? arena : choose_arena(), size, false);
 	if (!ret)
 		return nullptr;
 
@@ -3839,7 +3840,7 @@ IN_PLACE:
 }
 
 static inline void *
-iralloc(void *ptr, size_t size)
+iralloc(void *ptr, size_t size, arena_t *arena)
 {
 	size_t oldsize;
 
@@ -3849,7 +3850,7 @@ iralloc(void *ptr, size_t size)
 	oldsize = isalloc(ptr);
 
 	if (size <= arena_maxclass)
-		return (arena_ralloc(ptr, size, oldsize));
+		return (arena_ralloc(ptr, size, oldsize, arena));
 	else
 		return (huge_ralloc(ptr, size, oldsize));
 }
@@ -3943,9 +3944,12 @@ arenas_fallback()
 	return arenas[0];
 }
 
-/* Create a new arena and return it. */
+/*
+ * Create a new arena and return it.  On OOM, return arenas[0] if |fallback| is
+ * true, and nullptr otherwise.
+ */
 static arena_t *
-arenas_extend()
+arenas_extend(bool fallback)
 {
 	/*
 	 * The list of arenas is first allocated to contain at most 16 elements,
@@ -3960,8 +3964,8 @@ arenas_extend()
 	ret = (arena_t *)base_alloc(sizeof(arena_t)
 	    + (sizeof(arena_bin_t) * (ntbins + nqbins + nsbins - 1)));
 	if (!ret || arena_new(ret)) {
-		return arenas_fallback();
-        }
+		return (fallback ? arenas_fallback() : nullptr);
+	}
 
 	malloc_spin_lock(&arenas_lock);
 
@@ -3974,7 +3978,7 @@ arenas_extend()
 		 */
 		arena_t** new_arenas = (arena_t **)base_alloc(sizeof(arena_t *) * max_arenas);
 		if (!new_arenas) {
-			ret = arenas ? arenas_fallback() : nullptr;
+			ret = (fallback && arenas) ? arenas_fallback() : nullptr;
 			malloc_spin_unlock(&arenas_lock);
 			return (ret);
 		}
@@ -4455,7 +4459,7 @@ MALLOC_OUT:
 	/*
 	 * Initialize one arena here.
 	 */
-	arenas_extend();
+	arenas_extend(false);
 	if (!arenas || !arenas[0]) {
 #ifndef MOZ_MEMORY_WINDOWS
 		malloc_mutex_unlock(&init_lock);
@@ -4667,7 +4671,7 @@ realloc_impl(void *ptr, size_t size)
 	if (ptr) {
 		MOZ_ASSERT(malloc_initialized);
 
-		ret = iralloc(ptr, size);
+		ret = iralloc(ptr, size, nullptr);
 
 		if (!ret) {
 			errno = ENOMEM;
@@ -5012,6 +5016,132 @@ jemalloc_free_dirty_pages_impl(void)
 	malloc_spin_unlock(&arenas_lock);
 }
 
+/*
+ * Private arenas.  Allocations from an arena returned by moz_create_arena()
+ * never share runs with allocations from the malloc() arenas, which lets
+ * callers keep long-lived data away from short-lived churn.  Huge
+ * allocations are not arena-specific.  Private arenas are never destroyed.
+ */
+
+static inline arena_t *
+arena_from_id(arena_id_t arena_id)
+{
+	arena_t *arena = (arena_t *)arena_id;
+
+	MOZ_RELEASE_ASSERT(arena);
+	MOZ_DIAGNOSTIC_ASSERT(arena->magic == ARENA_MAGIC);
+	return (arena);
+}
+
+MOZ_JEMALLOC_API arena_id_t
+moz_create_arena_impl(void)
+{
+
+	if (malloc_init())
+		return (0);
+
+	/*
+	 * Don't fall back to arenas[0] here: a caller asking for a private
+	 * arena must not silently end up sharing the default one.
+	 */
+	return ((arena_id_t)arenas_extend(false));
+}
+
+MOZ_JEMALLOC_API void *
+moz_arena_malloc_impl(arena_id_t arena_id, size_t size)
+{
+	arena_t *arena = arena_from_id(arena_id);
+	void *ret;
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	if (size <= arena_maxclass)
+		ret = arena_malloc(arena, size, false);
+	else
+		ret = huge_malloc(size, false);
+
+	if (!ret) {
+		errno = ENOMEM;
+	}
+
+	return (ret);
+}
+
+MOZ_JEMALLOC_API void *
+moz_arena_calloc_impl(arena_id_t arena_id, size_t num, size_t size)
+{
+	arena_t *arena = arena_from_id(arena_id);
+	void *ret;
+	size_t num_size;
+
+	num_size = num * size;
+	if (num_size == 0) {
+		num_size = 1;
+	/* See calloc_impl(). */
+	} else if (((num | size) & (SIZE_T_MAX << (sizeof(size_t) << 2)))
+	    && (num_size / size != num)) {
+		/* size_t overflow. */
+		errno = ENOMEM;
+		return nullptr;
+	}
+
+	if (num_size <= arena_maxclass)
+		ret = arena_malloc(arena, num_size, true);
+	else
+		ret = huge_malloc(num_size, true);
+
+	if (!ret) {
+		errno = ENOMEM;
+	}
+
+	return (ret);
+}
+
+MOZ_JEMALLOC_API void *
+moz_arena_realloc_impl(arena_id_t arena_id, void *ptr, size_t size)
+{
+	void *ret;
+
+	if (!ptr)
+		return (moz_arena_malloc_impl(arena_id, size));
+
+	if (size == 0) {
+		size = 1;
+	}
+
+	/*
+	 * iralloc() can grow or shrink a non-huge allocation in place, which
+	 * would silently keep one that belongs to another arena.
+	 */
+	MOZ_ASSERT(CHUNK_ADDR2OFFSET(ptr) == 0 ||
+	    ((arena_chunk_t *)CHUNK_ADDR2BASE(ptr))->arena ==
+	    arena_from_id(arena_id));
+
+	ret = iralloc(ptr, size, arena_from_id(arena_id));
+
+	if (!ret) {
+		errno = ENOMEM;
+	}
+
+	return (ret);
+}
+
+MOZ_JEMALLOC_API void
+moz_arena_free_impl(arena_id_t arena_id, void *ptr)
+{
+	size_t offset;
+
+	offset = CHUNK_ADDR2OFFSET(ptr);
+	if (offset != 0) {
+		MOZ_ASSERT(((arena_chunk_t *)CHUNK_ADDR2BASE(ptr))->arena ==
+		    arena_from_id(arena_id));
+		arena_dalloc(ptr, offset);
+	} else if (ptr)
+		huge_dalloc(ptr);
+}
+
 /*
  * End non-standard functions.
  */
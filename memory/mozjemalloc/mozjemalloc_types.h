@@ -45,6 +45,9 @@ extern "C" {
 
 typedef unsigned char jemalloc_bool;
 
+/* Opaque handle for an arena returned by moz_create_arena(). */
+typedef size_t arena_id_t;
+
 /*
  * jemalloc_stats() is not a stable interface.  When using jemalloc_stats_t, be
  * sure that the compiled results of jemalloc.c are in sync with this header
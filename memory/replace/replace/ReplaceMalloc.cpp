@@ -261,3 +261,82 @@ replace_jemalloc_thread_local_arena(jemalloc_bool aEnabled)
     hook_table->jemalloc_thread_local_arena_hook(aEnabled);
   }
 }
+
+arena_id_t
+replace_moz_create_arena(void)
+{
+  arena_id_t arena = gFuncs->moz_create_arena();
+  const malloc_hook_table_t* hook_table = gHookTable;
+  if (hook_table && hook_table->moz_create_arena_hook) {
+    return hook_table->moz_create_arena_hook(arena);
+  }
+  return arena;
+}
+
+void*
+replace_moz_arena_malloc(arena_id_t aArena, size_t aSize)
+{
+  void* ptr = gFuncs->moz_arena_malloc(aArena, aSize);
+  const malloc_hook_table_t* hook_table = gHookTable;
+  if (hook_table) {
+    if (hook_table->moz_arena_malloc_hook) {
+      return hook_table->moz_arena_malloc_hook(ptr, aArena, aSize);
+    }
+    return hook_table->malloc_hook(ptr, aSize);
+  }
+  return ptr;
+}
+
+void*
+replace_moz_arena_calloc(arena_id_t aArena, size_t aNum, size_t aSize)
+{
+  void* ptr = gFuncs->moz_arena_calloc(aArena, aNum, aSize);
+  const malloc_hook_table_t* hook_table = gHookTable;
+  if (hook_table) {
+    if (hook_table->moz_arena_calloc_hook) {
+      return hook_table->moz_arena_calloc_hook(ptr, aArena, aNum, aSize);
+    }
+    /* See replace_calloc for the use of SIZE_MAX on overflow. */
+    mozilla::CheckedInt<size_t> size = mozilla::CheckedInt<size_t>(aNum) * aSize;
+    return hook_table->malloc_hook(ptr, size.isValid() ? size.value() : SIZE_MAX);
+  }
+  return ptr;
+}
+
+void*
+replace_moz_arena_realloc(arena_id_t aArena, void* aPtr, size_t aSize)
+{
+  const malloc_hook_table_t* hook_table = gHookTable;
+  if (hook_table) {
+    if (hook_table->realloc_hook_before) {
+      hook_table->realloc_hook_before(aPtr);
+    } else {
+      hook_table->free_hook(aPtr);
+    }
+  }
+  void* new_ptr = gFuncs->moz_arena_realloc(aArena, aPtr, aSize);
+  if (hook_table) {
+    if (hook_table->moz_arena_realloc_hook) {
+      return hook_table->moz_arena_realloc_hook(new_ptr, aArena, aPtr, aSize);
+    }
+    if (hook_table->realloc_hook) {
+      return hook_table->realloc_hook(new_ptr, aPtr, aSize);
+    }
+    return hook_table->malloc_hook(new_ptr, aSize);
+  }
+  return new_ptr;
+}
+
+void
+replace_moz_arena_free(arena_id_t aArena, void* aPtr)
+{
+  const malloc_hook_table_t* hook_table = gHookTable;
+  if (hook_table) {
+    if (hook_table->moz_arena_free_hook) {
+      hook_table->moz_arena_free_hook(aArena, aPtr);
+    } else {
+      hook_table->free_hook(aPtr);
+    }
+  }
+  gFuncs->moz_arena_free(aArena, aPtr);
+}
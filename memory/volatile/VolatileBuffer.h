@@ -58,6 +58,7 @@ public:
   size_t HeapSizeOfExcludingThis(MallocSizeOf aMallocSizeOf) const;
   size_t NonHeapSizeOfExcludingThis() const;
   bool OnHeap() const;
+  size_t Size() const { return mSize; }
 
 protected:
   bool Lock(void** aBuf);
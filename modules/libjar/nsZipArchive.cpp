@@ -941,6 +941,22 @@ int64_t nsZipArchive::SizeOfMapping()
     return mFd ? mFd->SizeOfMapping() : 0;
 }
 
+//---------------------------------------------
+// nsZipArchive::WillNeedMapping
+//---------------------------------------------
+void nsZipArchive::WillNeedMapping()
+{
+  if (!mFd || !mFd->mMap)
+    return;
+#if defined(XP_SOLARIS)
+  posix_madvise(const_cast<uint8_t*>(mFd->mFileStart), mFd->mTotalLen,
+                POSIX_MADV_WILLNEED);
+#elif defined(XP_UNIX)
+  madvise(const_cast<uint8_t*>(mFd->mFileStart), mFd->mTotalLen,
+          MADV_WILLNEED);
+#endif
+}
+
 //------------------------------------------
 // nsZipArchive constructor and destructor
 //------------------------------------------
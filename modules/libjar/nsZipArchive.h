@@ -208,6 +208,14 @@ public:
    */
   int64_t SizeOfMapping();
 
+  /**
+   * Hints to the OS that the whole mapping is about to be read, so that it
+   * can be paged in ahead of the first accesses. This is a no-op for
+   * archives that aren't backed by a file mapping, and on platforms
+   * without an asynchronous read-ahead hint.
+   */
+  void WillNeedMapping();
+
   /*
    * Refcounting
    */
@@ -270,8 +270,24 @@ PREF_ParseBuf(PrefParseState *ps, const char *buf, int bufLen)
                 state = ps->nextstate;
                 ps->nextstate = PREF_PARSE_INIT; /* reset next state */
             }
-            else
-                *ps->lbcur++ = c;
+            else {
+                /* copy the whole run of ordinary characters in one go. the
+                 * run stops before anything that needs the per-character
+                 * handling above, including line breaks, which are counted
+                 * at the top of the loop. */
+                const char *run = buf + 1;
+                while (run != end && *run != ps->quotechar && *run != '\\' &&
+                       *run != '\r' && *run != '\n' && *run != 0x1A)
+                    ++run;
+                int runLen = run - buf;
+                while (ps->lbend - ps->lbcur < runLen) {
+                    if (!pref_GrowBuf(ps))
+                        return false; /* out of memory */
+                }
+                memcpy(ps->lbcur, buf, runLen);
+                ps->lbcur += runLen;
+                buf = run - 1;
+            }
             break;
 
         /* name parsing */
@@ -390,6 +406,14 @@ PREF_ParseBuf(PrefParseState *ps, const char *buf, int bufLen)
         case PREF_PARSE_COMMENT_BLOCK:
             if (c == '*')
                 state = PREF_PARSE_COMMENT_BLOCK_MAYBE_END;
+            else {
+                /* skip ahead to the next '*', counting line breaks */
+                while (buf + 1 != end && buf[1] != '*') {
+                    ++buf;
+                    if (*buf == '\r' || *buf == '\n' || *buf == 0x1A)
+                        lineNum ++;
+                }
+            }
             break;
         case PREF_PARSE_COMMENT_BLOCK_MAYBE_END:
             switch (c) {
@@ -594,6 +618,12 @@ PREF_ParseBuf(PrefParseState *ps, const char *buf, int bufLen)
                 state = ps->nextstate;
                 ps->nextstate = PREF_PARSE_INIT; /* reset next state */
             }
+            else {
+                /* skip ahead to the end of the line */
+                while (buf + 1 != end && buf[1] != '\r' && buf[1] != '\n' &&
+                       buf[1] != 0x1A)
+                    ++buf;
+            }
             break;
         }
     }
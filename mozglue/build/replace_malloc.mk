@@ -20,6 +20,11 @@ OS_LDFLAGS += \
   -Wl,-U,_replace_jemalloc_purge_freed_pages \
   -Wl,-U,_replace_jemalloc_free_dirty_pages \
   -Wl,-U,_replace_jemalloc_thread_local_arena \
+  -Wl,-U,_replace_moz_create_arena \
+  -Wl,-U,_replace_moz_arena_malloc \
+  -Wl,-U,_replace_moz_arena_calloc \
+  -Wl,-U,_replace_moz_arena_realloc \
+  -Wl,-U,_replace_moz_arena_free \
   $(NULL)
 
 EXTRA_DEPS += $(topsrcdir)/mozglue/build/replace_malloc.mk
@@ -1471,18 +1471,10 @@ Predictor::RunPredictions(nsIURI *referrer,
   Telemetry::AutoCounter<Telemetry::PREDICTOR_TOTAL_PRECONNECTS> totalPreconnects;
   Telemetry::AutoCounter<Telemetry::PREDICTOR_TOTAL_PRERESOLVES> totalPreresolves;
 
-  len = prefetches.Length();
-  for (i = 0; i < len; ++i) {
-    PREDICTOR_LOG(("    doing prefetch"));
-    nsCOMPtr<nsIURI> uri = prefetches[i];
-    if (NS_SUCCEEDED(Prefetch(uri, referrer,
-                              originAttributes, verifier))) {
-      ++totalPredictions;
-      ++totalPrefetches;
-      predicted = true;
-    }
-  }
-
+  // Kick off the connection setup work first. Preconnects and preresolves
+  // take network round trips, while prefetches have to go through channel
+  // setup and the cache before they hit the network, so doing them last
+  // doesn't delay them, but doing them first would delay the handshakes.
   len = preconnects.Length();
   for (i = 0; i < len; ++i) {
     PREDICTOR_LOG(("    doing preconnect"));
@@ -1520,6 +1512,18 @@ Predictor::RunPredictions(nsIURI *referrer,
     }
   }
 
+  len = prefetches.Length();
+  for (i = 0; i < len; ++i) {
+    PREDICTOR_LOG(("    doing prefetch"));
+    nsCOMPtr<nsIURI> uri = prefetches[i];
+    if (NS_SUCCEEDED(Prefetch(uri, referrer,
+                              originAttributes, verifier))) {
+      ++totalPredictions;
+      ++totalPrefetches;
+      predicted = true;
+    }
+  }
+
   return predicted;
 }
 
@@ -1491,7 +1491,7 @@ nsSocketTransport::InitiateSocket()
 
     SOCKET_LOG(("  advancing to STATE_CONNECTING\n"));
     mState = STATE_CONNECTING;
-    mPollTimeout = mTimeouts[TIMEOUT_CONNECT];
+    SetPollTimeout(mTimeouts[TIMEOUT_CONNECT]);
     SendStatus(NS_NET_STATUS_CONNECTING_TO);
 
     if (SOCKET_LOG_ENABLED()) {
@@ -1891,6 +1891,17 @@ nsSocketTransport::OnMsgOutputClosed(nsresult reason)
     }
 }
 
+void
+nsSocketTransport::SetPollTimeout(uint16_t aTimeout)
+{
+    MOZ_ASSERT(OnSocketThread(), "not on socket thread");
+    // a lower timeout can be reached without any more poll time elapsing,
+    // which the service only notices if it checks every active socket.
+    if (aTimeout < mPollTimeout)
+        mSocketTransportService->NotePollTimeoutLowered();
+    mPollTimeout = aTimeout;
+}
+
 void
 nsSocketTransport::OnSocketConnected()
 {
@@ -1898,7 +1909,7 @@ nsSocketTransport::OnSocketConnected()
     SOCKET_LOG(("  advancing to STATE_TRANSFERRING\n"));
 
     mPollFlags = (PR_POLL_READ | PR_POLL_WRITE | PR_POLL_EXCEPT);
-    mPollTimeout = mTimeouts[TIMEOUT_READ_WRITE];
+    SetPollTimeout(mTimeouts[TIMEOUT_READ_WRITE]);
     mState = STATE_TRANSFERRING;
 
     // Set the m*AddrIsSet flags only when state has reached TRANSFERRING
@@ -2142,8 +2153,8 @@ nsSocketTransport::OnSocketEvent(uint32_t type, nsresult status, nsISupports *pa
         break;
     case MSG_TIMEOUT_CHANGED:
         SOCKET_LOG(("  MSG_TIMEOUT_CHANGED\n"));
-        mPollTimeout = mTimeouts[(mState == STATE_TRANSFERRING)
-          ? TIMEOUT_READ_WRITE : TIMEOUT_CONNECT];
+        SetPollTimeout(mTimeouts[(mState == STATE_TRANSFERRING)
+          ? TIMEOUT_READ_WRITE : TIMEOUT_CONNECT]);
         break;
     default:
         SOCKET_LOG(("  unhandled event!\n"));
@@ -2207,7 +2218,7 @@ nsSocketTransport::OnSocketReady(PRFileDesc *fd, int16_t outFlags)
             mInput.OnSocketReady(NS_OK);
         }
         // Update poll timeout in case it was changed
-        mPollTimeout = mTimeouts[TIMEOUT_READ_WRITE];
+        SetPollTimeout(mTimeouts[TIMEOUT_READ_WRITE]);
     }
     else if ((mState == STATE_CONNECTING) && !gIOService->IsNetTearingDown()) {
         // We do not need to do PR_ConnectContinue when we are already
@@ -2281,7 +2292,7 @@ nsSocketTransport::OnSocketReady(PRFileDesc *fd, int16_t outFlags)
                 // Set up the select flags for connect...
                 mPollFlags = (PR_POLL_EXCEPT | PR_POLL_WRITE);
                 // Update poll timeout in case it was changed
-                mPollTimeout = mTimeouts[TIMEOUT_CONNECT];
+                SetPollTimeout(mTimeouts[TIMEOUT_CONNECT]);
             }
             //
             // The SOCKS proxy rejected our request. Find out why.
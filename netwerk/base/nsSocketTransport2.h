@@ -378,6 +378,10 @@ private:
     // called when the socket is connected
     void OnSocketConnected();
 
+    // sets mPollTimeout, letting the socket transport service know when it
+    // is lowered.
+    void SetPollTimeout(uint16_t aTimeout);
+
     //-------------------------------------------------------------------------
     // socket input/output objects.  these may be accessed on any thread with
     // the exception of some specific methods (XXX).
@@ -82,6 +82,7 @@ nsSocketTransportService::nsSocketTransportService()
     , mIdleListSize(SOCKET_LIMIT_MIN)
     , mActiveCount(0)
     , mIdleCount(0)
+    , mPollTimeoutLowered(false)
     , mSentBytesCount(0)
     , mReceivedBytesCount(0)
     , mSendBufferSize(0)
@@ -331,6 +332,9 @@ nsSocketTransportService::AddToPollList(SocketContext *sock)
     mPollList[newSocketIndex + 1].in_flags = sock->mHandler->mPollFlags;
     mPollList[newSocketIndex + 1].out_flags = 0;
 
+    if (sock->mElapsedTime >= sock->mHandler->mPollTimeout)
+        mPollTimeoutLowered = true;
+
     SOCKET_LOG(("  active=%u idle=%u\n", mActiveCount, mIdleCount));
     return NS_OK;
 }
@@ -1181,17 +1185,34 @@ nsSocketTransportService::DoPollIteration(TimeDuration *pollDuration)
         //
         // service "active" sockets...
         //
+        // once every ready socket has been serviced, the rest only need to
+        // be visited to age and check their timeouts.  nothing ages when
+        // PR_Poll returned within a second, so the walk can stop early then,
+        // unless a socket may already be at or past its timeout (see
+        // mPollTimeoutLowered).
+        int32_t readyCount = n;
+        if (n > 0 && mPollList[0].fd && mPollList[0].out_flags != 0)
+            --readyCount;
+        bool canStopEarly = pollInterval == 0 && !mPollTimeoutLowered;
+        mPollTimeoutLowered = false;
+
         uint32_t numberOfOnSocketReadyCalls = 0;
         for (i=0; i<int32_t(mActiveCount); ++i) {
+            if (readyCount <= 0 && canStopEarly)
+                break;
             PRPollDesc &desc = mPollList[i+1];
             SocketContext &s = mActiveList[i];
             if (n > 0 && desc.out_flags != 0) {
 #ifdef MOZ_TASK_TRACER
 		tasktracer::AutoSourceEvent taskTracerEvent(tasktracer::SourceEventType::SocketIO);
 #endif
+                --readyCount;
                 s.mElapsedTime = 0;
                 s.mHandler->OnSocketReady(desc.fd, desc.out_flags);
                 numberOfOnSocketReadyCalls++;
+                // a timeout of 0 is reached again straight away.
+                if (s.mHandler->mPollTimeout == 0)
+                    mPollTimeoutLowered = true;
             }
             // check for timeout errors unless disabled...
             else if (s.mHandler->mPollTimeout != UINT16_MAX) {
@@ -1214,6 +1235,8 @@ nsSocketTransportService::DoPollIteration(TimeDuration *pollDuration)
                     s.mElapsedTime = 0;
                     s.mHandler->OnSocketReady(desc.fd, -1);
                     numberOfOnSocketReadyCalls++;
+                    if (s.mHandler->mPollTimeout == 0)
+                        mPollTimeoutLowered = true;
                 }
             }
         }
@@ -126,6 +126,11 @@ public:
                                                        !mSleepPhase; }
     PRIntervalTime MaxTimeForPrClosePref() {return mMaxTimeForPrClosePref; }
 
+    // Called on the socket thread by a handler that lowers its mPollTimeout
+    // while attached, which may take it past its timeout without any poll
+    // time elapsing.
+    void NotePollTimeoutLowered() { mPollTimeoutLowered = true; }
+
 #if defined(_WIN64) && defined(WIN95)
     void AddOverlappedPendingSocket(PRFileDesc *aFd);
     bool HasFileDesc2PlatformOverlappedIOHandleFunc();
@@ -191,6 +196,11 @@ private:
     uint32_t mActiveCount;
     uint32_t mIdleCount;
 
+    // set when an active socket may have reached its timeout other than by
+    // aging in DoPollIteration, so that the next iteration checks every
+    // active socket's timeout.
+    bool mPollTimeoutLowered;
+
     nsresult DetachSocket(SocketContext *, SocketContext *);
     nsresult AddToIdleList(SocketContext *);
     nsresult AddToPollList(SocketContext *);
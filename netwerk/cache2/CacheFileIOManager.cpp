@@ -50,6 +50,7 @@ namespace net {
 #define kMetadataWriteDelay      5000
 #define kRemoveTrashStartDelay   60000 // in milliseconds
 #define kSmartSizeUpdateInterval 60000 // in milliseconds
+#define kFreeSpaceUpdateInterval 1000  // in milliseconds
 
 #ifdef ANDROID
 const uint32_t kMaxCacheSizeKB = 200*1024; // 200 MB
@@ -1200,6 +1201,7 @@ CacheFileIOManager::CacheFileIOManager()
   , mTreeCreationFailed(false)
   , mOverLimitEvicting(false)
   , mCacheSizeOnHardLimit(false)
+  , mFreeSpace(-1)
   , mRemovingTrashDirs(false)
 {
   LOG(("CacheFileIOManager::CacheFileIOManager [this=%p]", this));
@@ -2122,18 +2124,28 @@ CacheFileIOManager::WriteInternal(CacheFileHandle *aHandle, int64_t aOffset,
       return NS_ERROR_FILE_DISK_FULL;
     }
 
-    int64_t freeSpace = -1;
-    rv = mCacheDirectory->GetDiskSpaceAvailable(&freeSpace);
-    if (NS_WARN_IF(NS_FAILED(rv))) {
-      LOG(("CacheFileIOManager::WriteInternal() - GetDiskSpaceAvailable() "
-           "failed! [rv=0x%08" PRIx32 "]", static_cast<uint32_t>(rv)));
-    } else {
-      uint32_t limit = CacheObserver::DiskFreeSpaceHardLimit();
-      if (freeSpace - aOffset - aCount + aHandle->mFileSize < limit) {
-        LOG(("CacheFileIOManager::WriteInternal() - Low free space, refusing "
-             "to write! [freeSpace=%" PRId64 ", limit=%u]", freeSpace, limit));
-        return NS_ERROR_FILE_DISK_FULL;
-      }
+    // Querying the free space costs a syscall on every write that grows a
+    // file, which is most chunk writes. Reuse the value obtained during the
+    // last kFreeSpaceUpdateInterval, it's decreased by what we write below.
+    // The estimate is refreshed before we refuse the write.
+    static const TimeDuration kFreeSpaceUpdateLimit =
+      TimeDuration::FromMilliseconds(kFreeSpaceUpdateInterval);
+    uint32_t limit = CacheObserver::DiskFreeSpaceHardLimit();
+    bool refreshed = false;
+    if (mFreeSpaceTime.IsNull() ||
+        (TimeStamp::NowLoRes() - mFreeSpaceTime) >= kFreeSpaceUpdateLimit ||
+        mFreeSpace - aOffset - aCount + aHandle->mFileSize < limit) {
+      UpdateFreeSpace();
+      refreshed = true;
+    }
+
+    if (mFreeSpaceTime.IsNull()) {
+      LOG(("CacheFileIOManager::WriteInternal() - free space is unknown"));
+    } else if (mFreeSpace - aOffset - aCount + aHandle->mFileSize < limit) {
+      LOG(("CacheFileIOManager::WriteInternal() - Low free space, refusing "
+           "to write! [freeSpace=%" PRId64 ", limit=%u, refreshed=%d]",
+           mFreeSpace, limit, refreshed));
+      return NS_ERROR_FILE_DISK_FULL;
     }
   }
 
@@ -2151,6 +2163,10 @@ CacheFileIOManager::WriteInternal(CacheFileHandle *aHandle, int64_t aOffset,
     uint32_t oldSizeInK = aHandle->FileSizeInK();
     int64_t writeEnd = aOffset + bytesWritten;
 
+    if (aHandle->mFileSize < writeEnd && !mFreeSpaceTime.IsNull()) {
+      mFreeSpace -= writeEnd - aHandle->mFileSize;
+    }
+
     if (aTruncate) {
       rv = TruncFile(aHandle->mFD, writeEnd);
       NS_ENSURE_SUCCESS(rv, rv);
@@ -3732,11 +3748,16 @@ CacheFileIOManager::CreateFile(CacheFileHandle *aHandle)
     NS_ENSURE_SUCCESS(rv, rv);
 
     aHandle->mFile.swap(file);
+#ifdef DEBUG
   } else {
+    // The sanity check costs a stat() per newly created entry, which adds up
+    // with many small entries, so do it only in debug builds. The file is
+    // truncated when opened below anyway.
     bool exists;
     if (NS_SUCCEEDED(aHandle->mFile->Exists(&exists)) && exists) {
       NS_WARNING("Found a file that should not exist!");
     }
+#endif
   }
 
   rv = OpenNSPRHandle(aHandle, true);
@@ -4258,6 +4279,23 @@ SmartCacheSize(const uint32_t availKB)
   return std::min<uint32_t>(maxSize, sz10MBs * 10 * 1024);
 }
 
+void
+CacheFileIOManager::UpdateFreeSpace()
+{
+  MOZ_ASSERT(mIOThread->IsCurrentThread());
+
+  nsresult rv = mCacheDirectory->GetDiskSpaceAvailable(&mFreeSpace);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    LOG(("CacheFileIOManager::UpdateFreeSpace() - GetDiskSpaceAvailable() "
+         "failed! [rv=0x%08" PRIx32 "]", static_cast<uint32_t>(rv)));
+    mFreeSpace = -1;
+    mFreeSpaceTime = TimeStamp();
+    return;
+  }
+
+  mFreeSpaceTime = TimeStamp::NowLoRes();
+}
+
 nsresult
 CacheFileIOManager::UpdateSmartCacheSize(int64_t aFreeSpace)
 {
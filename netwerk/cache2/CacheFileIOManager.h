@@ -454,6 +454,10 @@ private:
   // before we start an eviction loop.
   nsresult UpdateSmartCacheSize(int64_t aFreeSpace);
 
+  // Refreshes mFreeSpace, the cached amount of free disk space that
+  // WriteInternal() checks against the hard limit. Must be called on IO thread.
+  void UpdateFreeSpace();
+
   // Memory reporting (private part)
   size_t SizeOfExcludingThisInternal(mozilla::MallocSizeOf mallocSizeOf) const;
 
@@ -491,6 +495,9 @@ private:
   nsTArray<nsCString>                  mFailedTrashDirs;
   RefPtr<CacheFileContextEvictor>      mContextEvictor;
   TimeStamp                            mLastSmartSizeTime;
+  // Free disk space estimate and the time it was obtained (null if unknown).
+  int64_t                              mFreeSpace;
+  TimeStamp                            mFreeSpaceTime;
 };
 
 } // namespace net
@@ -1187,7 +1187,11 @@ CacheIndex::HasEntry(const SHA1Sum::Hash &hash, EntryStatus *_retval,
 {
   StaticMutexAutoLock lock(sLock);
 
-  RefPtr<CacheIndex> index = gInstance;
+  // This is called for every entry open, so don't pay for an atomic
+  // AddRef/Release pair here. gInstance is only cleared in Shutdown() while
+  // holding sLock and nothing below releases the lock, so a raw pointer is
+  // safe for the whole lookup.
+  CacheIndex *index = gInstance;
 
   if (!index) {
     return NS_ERROR_NOT_INITIALIZED;
@@ -3276,9 +3276,13 @@ nsCookieService::GetCookiesForURI(nsIURI *aHostURI,
     return;
   }
 
-  // check default prefs
+  // check default prefs. CheckPrefs only looks at the prior cookie count for
+  // third-party requests, so don't pay for the extra base domain and hash
+  // lookup on every first-party load.
   uint32_t priorCookieCount = 0;
-  CountCookiesFromHost(hostFromURI, &priorCookieCount);
+  if (aIsForeign) {
+    CountCookiesFromHost(hostFromURI, &priorCookieCount);
+  }
   CookieStatus cookieStatus = CheckPrefs(mPermissionService, mCookieBehavior,
                                          mThirdPartySession, aHostURI, aIsForeign,
                                          nullptr, priorCookieCount);
@@ -3419,11 +3423,10 @@ nsCookieService::GetCookieStringInternal(nsIURI *aHostURI,
 
       if (!cookie->Name().IsEmpty()) {
         // we have a name and value - write both
-        aCookieString += cookie->Name() + NS_LITERAL_CSTRING("=") + cookie->Value();
-      } else {
-        // just write value
-        aCookieString += cookie->Value();
+        aCookieString.Append(cookie->Name());
+        aCookieString.Append('=');
       }
+      aCookieString.Append(cookie->Value());
     }
   }
 
@@ -53,6 +53,12 @@ static const char kPrefDnsLocalDomains[]     = "network.dns.localDomains";
 static const char kPrefDnsForceResolve[]     = "network.dns.forceResolve";
 static const char kPrefDnsOfflineLocalhost[] = "network.dns.offline-localhost";
 static const char kPrefDnsNotifyResolution[] = "network.dns.notifyResolution";
+static const char kPrefDnsMaxAnyPriorityThreads[] = "network.dns.max_any_priority_threads";
+static const char kPrefDnsMaxHighPriorityThreads[] = "network.dns.max_high_priority_threads";
+// When record TTLs are used (network.dns.get-ttl), also apply the grace period
+// after the TTL runs out: the expired record is still answered from the cache
+// while it is renewed in the background, instead of the lookup blocking.
+static const char kPrefDnsStaleWhileRevalidate[] = "network.dns.stale-while-revalidate";
 
 //-----------------------------------------------------------------------------
 
@@ -540,6 +546,9 @@ nsDNSService::Init()
     uint32_t maxCacheEntries  = 400;
     uint32_t defaultCacheLifetime = 120; // seconds
     uint32_t defaultGracePeriod = 60; // seconds
+    uint32_t maxAnyPriorityThreads = MAX_RESOLVER_THREADS_FOR_ANY_PRIORITY;
+    uint32_t maxHighPriorityThreads = MAX_RESOLVER_THREADS_FOR_HIGH_PRIORITY;
+    bool     staleWhileRevalidate = false;
     bool     disableIPv6      = false;
     bool     offlineLocalhost = true;
     bool     disablePrefetch  = false;
@@ -561,8 +570,15 @@ nsDNSService::Init()
             defaultCacheLifetime = val;
         if (NS_SUCCEEDED(prefs->GetIntPref(kPrefDnsCacheGrace, &val)))
             defaultGracePeriod = val;
+        if (NS_SUCCEEDED(prefs->GetIntPref(kPrefDnsMaxAnyPriorityThreads, &val)) &&
+            val > 0)
+            maxAnyPriorityThreads = (uint32_t) val;
+        if (NS_SUCCEEDED(prefs->GetIntPref(kPrefDnsMaxHighPriorityThreads, &val)) &&
+            val >= 0)
+            maxHighPriorityThreads = (uint32_t) val;
 
         // ASSUMPTION: pref branch does not modify out params on failure
+        prefs->GetBoolPref(kPrefDnsStaleWhileRevalidate, &staleWhileRevalidate);
         prefs->GetBoolPref(kPrefDisableIPv6, &disableIPv6);
         prefs->GetCharPref(kPrefIPv4OnlyDomains, getter_Copies(ipv4OnlyDomains));
         prefs->GetCharPref(kPrefDnsLocalDomains, getter_Copies(localDomains));
@@ -590,6 +606,9 @@ nsDNSService::Init()
             prefs->AddObserver(kPrefDisablePrefetch, this, false);
             prefs->AddObserver(kPrefBlockDotOnion, this, false);
             prefs->AddObserver(kPrefDnsNotifyResolution, this, false);
+            prefs->AddObserver(kPrefDnsMaxAnyPriorityThreads, this, false);
+            prefs->AddObserver(kPrefDnsMaxHighPriorityThreads, this, false);
+            prefs->AddObserver(kPrefDnsStaleWhileRevalidate, this, false);
 
             // Monitor these to see if there is a change in proxy configuration
             // If a manual proxy is in use, disable prefetch implicitly
@@ -612,6 +631,9 @@ nsDNSService::Init()
     nsresult rv = nsHostResolver::Create(maxCacheEntries,
                                          defaultCacheLifetime,
                                          defaultGracePeriod,
+                                         maxAnyPriorityThreads,
+                                         maxHighPriorityThreads,
+                                         staleWhileRevalidate,
                                          getter_AddRefs(res));
     if (NS_SUCCEEDED(rv)) {
         // now, set all of our member variables while holding the lock
@@ -50,23 +50,23 @@ static const unsigned int NEGATIVE_RECORD_LIFETIME = 60;
 // In particular, thread creation results in a res_init() call from libc which is
 // quite expensive.
 //
-// The pool dynamically grows between 0 and MAX_RESOLVER_THREADS in size. New requests
-// go first to an idle thread. If that cannot be found and there are fewer than MAX_RESOLVER_THREADS
+// The pool dynamically grows between 0 and mMaxResolverThreads in size. New requests
+// go first to an idle thread. If that cannot be found and there are fewer than mMaxResolverThreads
 // currently in the pool a new thread is created for high priority requests. If
 // the new request is at a lower priority a new thread will only be created if
-// there are fewer than HighThreadThreshold currently outstanding. If a thread cannot be
+// there are fewer than mMaxAnyPriorityThreads currently outstanding. If a thread cannot be
 // created or an idle thread located for the request it is queued.
 //
-// When the pool is greater than HighThreadThreshold in size a thread will be destroyed after
+// When the pool is greater than mMaxAnyPriorityThreads in size a thread will be destroyed after
 // ShortIdleTimeoutSeconds of idle time. Smaller pools use LongIdleTimeoutSeconds for a
 // timeout period.
+//
+// Both limits default to MAX_RESOLVER_THREADS_FOR_ANY_PRIORITY and
+// MAX_RESOLVER_THREADS_FOR_HIGH_PRIORITY and can be raised through prefs, so
+// that a few slow lookups don't hold up every other host on a page.
 
-#define HighThreadThreshold     MAX_RESOLVER_THREADS_FOR_ANY_PRIORITY
-#define LongIdleTimeoutSeconds  300           // for threads 1 -> HighThreadThreshold
-#define ShortIdleTimeoutSeconds 60            // for threads HighThreadThreshold+1 -> MAX_RESOLVER_THREADS
-
-static_assert(HighThreadThreshold <= MAX_RESOLVER_THREADS,
-              "High Thread Threshold should be less equal Maximum allowed thread");
+#define LongIdleTimeoutSeconds  300           // for threads 1 -> mMaxAnyPriorityThreads
+#define ShortIdleTimeoutSeconds 60            // for threads mMaxAnyPriorityThreads+1 -> mMaxResolverThreads
 
 //----------------------------------------------------------------------------
 
@@ -526,10 +526,16 @@ static void DnsPrefChanged(const char* aPref, void* aClosure)
 
 nsHostResolver::nsHostResolver(uint32_t maxCacheEntries,
                                uint32_t defaultCacheEntryLifetime,
-                               uint32_t defaultGracePeriod)
+                               uint32_t defaultGracePeriod,
+                               uint32_t maxAnyPriorityThreads,
+                               uint32_t maxHighPriorityThreads,
+                               bool staleWhileRevalidate)
     : mMaxCacheEntries(maxCacheEntries)
     , mDefaultCacheLifetime(defaultCacheEntryLifetime)
     , mDefaultGracePeriod(defaultGracePeriod)
+    , mStaleWhileRevalidate(staleWhileRevalidate)
+    , mMaxAnyPriorityThreads(maxAnyPriorityThreads)
+    , mMaxResolverThreads(mMaxAnyPriorityThreads + maxHighPriorityThreads)
     , mLock("nsHostResolver.mLock")
     , mIdleThreadCV(mLock, "nsHostResolver.mIdleThreadCV")
     , mDB(&gHostDB_ops, sizeof(nsHostDBEnt), 0)
@@ -1023,8 +1029,8 @@ nsHostResolver::ConditionallyCreateThread(nsHostRecord *rec)
         // wake up idle thread to process this lookup
         mIdleThreadCV.Notify();
     }
-    else if ((mThreadCount < HighThreadThreshold) ||
-             (IsHighPriority(rec->flags) && mThreadCount < MAX_RESOLVER_THREADS)) {
+    else if ((mThreadCount < mMaxAnyPriorityThreads) ||
+             (IsHighPriority(rec->flags) && mThreadCount < mMaxResolverThreads)) {
         // dispatch new worker thread
         NS_ADDREF_THIS(); // owning reference passed to thread
 
@@ -1130,7 +1136,7 @@ nsHostResolver::GetHostToLookup(nsHostRecord **result)
 
     MutexAutoLock lock(mLock);
 
-    timeout = (mNumIdleThreads >= HighThreadThreshold) ? mShortIdleTimeout : mLongIdleTimeout;
+    timeout = (mNumIdleThreads >= mMaxAnyPriorityThreads) ? mShortIdleTimeout : mLongIdleTimeout;
     epoch = PR_IntervalNow();
 
     while (!mShutdown) {
@@ -1149,7 +1155,7 @@ nsHostResolver::GetHostToLookup(nsHostRecord **result)
             return true;
         }
 
-        if (mActiveAnyThreadCount < HighThreadThreshold) {
+        if (mActiveAnyThreadCount < mMaxAnyPriorityThreads) {
             if (!PR_CLIST_IS_EMPTY(&mMediumQ)) {
                 DeQueue (mMediumQ, result);
                 mActiveAnyThreadCount++;
@@ -1221,7 +1227,12 @@ nsHostResolver::PrepareRecordExpiration(nsHostRecord* rec) const
             ttl = rec->addr_info->ttl;
         }
         lifetime = ttl;
-        grace = 0;
+        // Unless stale-while-revalidate is on, a lookup past the TTL blocks
+        // on a fresh resolution. With it, the grace period follows the TTL,
+        // and ConditionallyRefreshRecord renews the record in the background.
+        if (!mStaleWhileRevalidate) {
+            grace = 0;
+        }
     }
 #endif
 
@@ -1543,10 +1554,14 @@ nsresult
 nsHostResolver::Create(uint32_t maxCacheEntries,
                        uint32_t defaultCacheEntryLifetime,
                        uint32_t defaultGracePeriod,
+                       uint32_t maxAnyPriorityThreads,
+                       uint32_t maxHighPriorityThreads,
+                       bool staleWhileRevalidate,
                        nsHostResolver **result)
 {
     auto *res = new nsHostResolver(maxCacheEntries, defaultCacheEntryLifetime,
-                                             defaultGracePeriod);
+                                   defaultGracePeriod, maxAnyPriorityThreads,
+                                   maxHighPriorityThreads, staleWhileRevalidate);
     NS_ADDREF(res);
 
     nsresult rv = res->Init();
@@ -30,9 +30,6 @@ class nsResolveHostCallback;
 #define MAX_RESOLVER_THREADS_FOR_HIGH_PRIORITY 5
 #define MAX_NON_PRIORITY_REQUESTS 150
 
-#define MAX_RESOLVER_THREADS (MAX_RESOLVER_THREADS_FOR_ANY_PRIORITY + \
-                              MAX_RESOLVER_THREADS_FOR_HIGH_PRIORITY)
-
 struct nsHostKey
 {
     const char *host;
@@ -226,6 +223,9 @@ public:
     static nsresult Create(uint32_t maxCacheEntries, // zero disables cache
                            uint32_t defaultCacheEntryLifetime, // seconds
                            uint32_t defaultGracePeriod, // seconds
+                           uint32_t maxAnyPriorityThreads,
+                           uint32_t maxHighPriorityThreads,
+                           bool staleWhileRevalidate, // grace after TTLs
                            nsHostResolver **resolver);
 
     /**
@@ -305,7 +305,10 @@ public:
 private:
    explicit nsHostResolver(uint32_t maxCacheEntries,
                            uint32_t defaultCacheEntryLifetime,
-                           uint32_t defaultGracePeriod);
+                           uint32_t defaultGracePeriod,
+                           uint32_t maxAnyPriorityThreads,
+                           uint32_t maxHighPriorityThreads,
+                           bool staleWhileRevalidate);
    ~nsHostResolver();
 
     nsresult Init();
@@ -345,6 +348,12 @@ private:
     uint32_t      mMaxCacheEntries;
     uint32_t      mDefaultCacheLifetime; // granularity seconds
     uint32_t      mDefaultGracePeriod; // granularity seconds
+    // Whether the grace period also follows TTL-derived lifetimes.
+    bool          mStaleWhileRevalidate;
+    // Threads that may serve any request, and the total including the extra
+    // threads reserved for high priority requests.
+    uint32_t      mMaxAnyPriorityThreads;
+    uint32_t      mMaxResolverThreads;
     mutable Mutex mLock;    // mutable so SizeOfIncludingThis can be const
     CondVar       mIdleThreadCV;
     PLDHashTable  mDB;
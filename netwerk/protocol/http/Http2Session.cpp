@@ -791,18 +791,19 @@ Http2Session::GenerateSettingsAck()
 }
 
 void
-Http2Session::GeneratePriority(uint32_t aID, uint8_t aPriorityWeight)
+Http2Session::GeneratePriority(uint32_t aID, uint8_t aPriorityWeight,
+                               uint32_t aDependency)
 {
   MOZ_ASSERT(OnSocketThread(), "not on socket thread");
-  LOG3(("Http2Session::GeneratePriority %p %X %X\n",
-        this, aID, aPriorityWeight));
+  LOG3(("Http2Session::GeneratePriority %p %X %X %X\n",
+        this, aID, aPriorityWeight, aDependency));
 
   uint32_t frameSize = kFrameHeaderBytes + 5;
   char *packet = EnsureOutputBuffer(frameSize);
   mOutputQueueUsed += frameSize;
 
   CreateFrameHeader(packet, 5, FRAME_TYPE_PRIORITY, 0, aID);
-  NetworkEndian::writeUint32(packet + kFrameHeaderBytes, 0);
+  NetworkEndian::writeUint32(packet + kFrameHeaderBytes, aDependency);
   memcpy(packet + frameSize - 1, &aPriorityWeight, 1);
   LogIO(this, nullptr, "Generate Priority", packet, frameSize);
   FlushOutputQueue();
@@ -1882,7 +1883,7 @@ Http2Session::RecvPushPromise(Http2Session *self)
   uint8_t priorityWeight = (nsISupportsPriority::PRIORITY_LOWEST + 1) -
     (Http2Stream::kWorstPriority - Http2Stream::kNormalPriority);
   pushedStream->SetPriority(Http2Stream::kWorstPriority);
-  self->GeneratePriority(promisedID, priorityWeight);
+  self->GeneratePriority(promisedID, priorityWeight, 0);
   self->ResetDownstreamState();
   return NS_OK;
 }
@@ -4138,6 +4139,35 @@ Http2Session::TransactionHasDataToWrite(nsAHttpTransaction *caller)
   Unused << ForceSend();
 }
 
+void
+Http2Session::TransactionClassOfServiceChanged(nsAHttpTransaction *caller)
+{
+  MOZ_ASSERT(OnSocketThread(), "not on socket thread");
+
+  Http2Stream *stream = mStreamTransactionHash.Get(caller);
+  if (!stream || !VerifyStream(stream)) {
+    return;
+  }
+
+  // A stream that hasn't sent its HEADERS yet picks up the new class of
+  // service when it does.
+  if (!stream->StreamID() || mClosed) {
+    return;
+  }
+
+  uint32_t previousDependency = stream->PriorityDependency();
+  stream->UpdatePriorityDependency();
+  if (stream->PriorityDependency() == previousDependency) {
+    return;
+  }
+
+  LOG3(("Http2Session::TransactionClassOfServiceChanged %p stream 0x%X "
+        "now depends on 0x%X\n", this, stream->StreamID(),
+        stream->PriorityDependency()));
+  GeneratePriority(stream->StreamID(), stream->PriorityWeight(),
+                   stream->PriorityDependency());
+}
+
 void
 Http2Session::TransactionHasDataToRecv(nsAHttpTransaction *caller)
 {
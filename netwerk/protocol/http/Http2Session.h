@@ -209,6 +209,7 @@ public:
   // overload of nsAHttpConnection
   void TransactionHasDataToWrite(nsAHttpTransaction *) override;
   void TransactionHasDataToRecv(nsAHttpTransaction *) override;
+  void TransactionClassOfServiceChanged(nsAHttpTransaction *) override;
 
   // a similar version for Http2Stream
   void TransactionHasDataToWrite(Http2Stream *);
@@ -282,7 +283,7 @@ private:
   MOZ_MUST_USE nsresult UncompressAndDiscard(bool);
   void        GeneratePing(bool);
   void        GenerateSettingsAck();
-  void        GeneratePriority(uint32_t, uint8_t);
+  void        GeneratePriority(uint32_t, uint8_t, uint32_t);
   void        GenerateRstStream(uint32_t, uint32_t);
   void        GenerateGoAway(uint32_t);
   void        CleanupStream(Http2Stream *, nsresult, errorType);
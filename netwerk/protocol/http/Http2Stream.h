@@ -148,6 +148,8 @@ public:
   void SetPriority(uint32_t);
   void SetPriorityDependency(uint32_t, uint8_t, bool);
   void UpdatePriorityDependency();
+  uint32_t PriorityDependency() { return mPriorityDependency; }
+  uint8_t PriorityWeight() { return mPriorityWeight; }
 
   // A pull stream has an implicit sink, a pushed stream has a sink
   // once it is matched to a pull stream.
@@ -64,6 +64,8 @@
 #include "nsIDOMWindowUtils.h"
 #include "nsHttpChannel.h"
 #include "nsRedirectHistoryEntry.h"
+#include "GeckoProfiler.h"
+#include "ProfilerMarkerPayload.h"
 
 #include <algorithm>
 #include "HttpBaseChannel.h"
@@ -3963,6 +3965,24 @@ IMPL_TIMING_ATTR(RedirectEnd)
 
 #undef IMPL_TIMING_ATTR
 
+void
+HttpBaseChannel::AddNetworkMarker(nsresult aStatus)
+{
+  if (!profiler_is_active()) {
+    return;
+  }
+
+  nsAutoCString spec;
+  if (mURI) {
+    mURI->GetAsciiSpec(spec);
+  }
+  profiler_add_marker("Load",
+                      MakeUnique<NetworkMarkerPayload>(mChannelId, spec.get(),
+                                                       aStatus,
+                                                       mAsyncOpenTime,
+                                                       TimeStamp::Now()));
+}
+
 mozilla::dom::Performance*
 HttpBaseChannel::GetPerformance()
 {
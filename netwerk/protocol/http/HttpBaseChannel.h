@@ -386,6 +386,9 @@ protected:
   void NotifySetCookie(char const *aCookie);
 
   mozilla::dom::Performance* GetPerformance();
+  // Adds a profiler marker covering this channel from AsyncOpen up to now,
+  // if the profiler is running.
+  void AddNetworkMarker(nsresult aStatus);
   nsIURI* GetReferringPage();
   nsPIDOMWindowInner* GetInnerDOMWindow();
 
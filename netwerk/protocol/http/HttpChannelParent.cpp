@@ -1604,13 +1604,11 @@ HttpChannelParent::OnDataAvailable(nsIRequest *aRequest,
   static uint32_t const kCopyChunkSize = 128 * 1024;
   uint32_t toRead = std::min<uint32_t>(aCount, kCopyChunkSize);
 
-  nsCString data;
-  if (!data.SetCapacity(toRead, fallible)) {
-    LOG(("  out of memory!"));
-    return NS_ERROR_OUT_OF_MEMORY;
-  }
-
   while (aCount) {
+    // Read each chunk into a fresh string. The previous chunk's buffer is
+    // still shared with the runnable that sends it from the background
+    // thread, and reusing it would first copy its stale contents over.
+    nsCString data;
     nsresult rv = NS_ReadInputStreamToString(aInputStream, data, toRead);
     if (NS_FAILED(rv)) {
       return rv;
@@ -77,6 +77,14 @@ public:
         // by default do nothing - only multiplexed protocols need to overload
     }
 
+    // Called when the class of service of a transaction changes after it
+    // has been dispatched, so that a multiplexed connection can reprioritize
+    // the transaction's stream.
+    virtual void TransactionClassOfServiceChanged(nsAHttpTransaction *)
+    {
+        // by default do nothing - only multiplexed protocols need to overload
+    }
+
     // called by the connection manager to close a transaction being processed
     // by this connection.
     //
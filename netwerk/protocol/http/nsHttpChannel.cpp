@@ -3902,7 +3902,10 @@ nsHttpChannel::OpenCacheEntry(bool isHttps)
     }
     NS_ENSURE_SUCCESS(rv, rv);
 
-    if ((mClassOfService & nsIClassOfService::Leader) ||
+    // Render-blocking and user-urgent loads should not wait on the cache IO
+    // thread behind bulk entry opens and reads of e.g. images.
+    if ((mClassOfService & (nsIClassOfService::Leader |
+                            nsIClassOfService::UrgentStart)) ||
         (mLoadFlags & LOAD_INITIAL_DOCUMENT_URI))
         cacheEntryOpenFlags |= nsICacheStorage::OPEN_PRIORITY;
 
@@ -7523,6 +7526,7 @@ nsHttpChannel::OnStopRequest(nsIRequest *request, nsISupports *ctxt, nsresult st
                    "OnStartRequest should be called before OnStopRequest");
         MOZ_ASSERT(!mOnStopRequestCalled,
                    "We should not call OnStopRequest twice");
+        AddNetworkMarker(status);
         mListener->OnStopRequest(this, mListenerContext, status);
         mOnStopRequestCalled = true;
     }
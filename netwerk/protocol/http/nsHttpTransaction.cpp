@@ -185,9 +185,14 @@ bool nsHttpTransaction::EligibleForThrottling() const
 void nsHttpTransaction::SetClassOfService(uint32_t cos)
 {
     bool wasThrottling = EligibleForThrottling();
+    uint32_t previous = mClassOfService;
     mClassOfService = cos;
     bool isThrottling = EligibleForThrottling();
 
+    if (mConnection && previous != cos) {
+        mConnection->TransactionClassOfServiceChanged(this);
+    }
+
     if (mConnection && wasThrottling != isThrottling) {
         // Do nothing until we are actually activated.  For now
         // only remember the throttle flag.  Call to UpdateActiveTransaction
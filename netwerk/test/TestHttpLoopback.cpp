@@ -0,0 +1,469 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Loads a loopback HTTP/1.1 server through nsIChannel at a fixed concurrency
+// and reports p50/p99 latency for each load stage, plus throughput, from
+// nsITimedChannel. The first pass goes to the network; the second loads the
+// same URLs again, which are then served from the HTTP cache when one is
+// available. gtest normally runs without a profile, and so without a disk
+// cache: the second pass then goes to the network too, and its cacheread
+// stage reports n/a.
+//
+// This is a benchmark, not a correctness test, so it is disabled and has to
+// be asked for:
+//
+//   GTEST_ALSO_RUN_DISABLED_TESTS=1 ./mach gtest 'TestHttpLoopback.*'
+//
+// The load count, concurrency and body size can be set with the
+// MOZ_NECKO_BENCH_LOADS, MOZ_NECKO_BENCH_CONCURRENCY and
+// MOZ_NECKO_BENCH_BODY_SIZE environment variables. Concurrency beyond
+// network.http.max-persistent-connections-per-server queues in the
+// connection manager, as it would against a real server.
+
+#include "TestCommon.h"
+#include "gtest/gtest.h"
+#include "nsIServerSocket.h"
+#include "nsISocketTransport.h"
+#include "nsIAsyncInputStream.h"
+#include "nsIAsyncOutputStream.h"
+#include "nsIChannel.h"
+#include "nsIStreamListener.h"
+#include "nsITimedChannel.h"
+#include "nsIURI.h"
+#include "nsContentUtils.h"
+#include "nsComponentManagerUtils.h"
+#include "nsNetUtil.h"
+#include "nsStreamUtils.h"
+#include "nsString.h"
+#include "nsPrintfCString.h"
+#include "mozilla/TimeStamp.h"
+#include "prenv.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace mozilla;
+
+static uint32_t
+GetEnvUint(const char* aName, uint32_t aDefault)
+{
+  const char* value = PR_GetEnv(aName);
+  if (!value || !*value) {
+    return aDefault;
+  }
+  long result = strtol(value, nullptr, 10);
+  return result > 0 ? uint32_t(result) : aDefault;
+}
+
+//-----------------------------------------------------------------------------
+// Server side. Everything here runs on the socket thread.
+
+class HttpServerConnection : public nsIInputStreamCallback
+                           , public nsIOutputStreamCallback
+{
+public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+  NS_DECL_NSIINPUTSTREAMCALLBACK
+  NS_DECL_NSIOUTPUTSTREAMCALLBACK
+
+  HttpServerConnection(nsISocketTransport* aTransport,
+                       const nsACString& aResponse);
+
+  nsresult Start();
+
+private:
+  virtual ~HttpServerConnection() = default;
+
+  void Close();
+  nsresult Flush();
+
+  nsCOMPtr<nsISocketTransport> mTransport;
+  nsCOMPtr<nsIAsyncInputStream> mInput;
+  nsCOMPtr<nsIAsyncOutputStream> mOutput;
+  const nsCString mResponse;
+  // Bytes of the request(s) received but not answered yet.
+  nsCString mRequest;
+  // Responses not written yet, starting at mWritten.
+  nsCString mPending;
+  uint32_t mWritten;
+};
+
+NS_IMPL_ISUPPORTS(HttpServerConnection,
+                  nsIInputStreamCallback,
+                  nsIOutputStreamCallback)
+
+HttpServerConnection::HttpServerConnection(nsISocketTransport* aTransport,
+                                           const nsACString& aResponse)
+  : mTransport(aTransport)
+  , mResponse(aResponse)
+  , mWritten(0)
+{
+}
+
+nsresult
+HttpServerConnection::Start()
+{
+  nsCOMPtr<nsIInputStream> input;
+  nsresult rv = mTransport->OpenInputStream(nsITransport::OPEN_UNBUFFERED,
+                                            0, 0, getter_AddRefs(input));
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  nsCOMPtr<nsIOutputStream> output;
+  rv = mTransport->OpenOutputStream(nsITransport::OPEN_UNBUFFERED,
+                                    0, 0, getter_AddRefs(output));
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  mInput = do_QueryInterface(input);
+  mOutput = do_QueryInterface(output);
+  if (!mInput || !mOutput) {
+    return NS_ERROR_UNEXPECTED;
+  }
+  return mInput->AsyncWait(this, 0, 0, nullptr);
+}
+
+void
+HttpServerConnection::Close()
+{
+  mInput->Close();
+  mOutput->Close();
+  mTransport->Close(NS_OK);
+}
+
+NS_IMETHODIMP
+HttpServerConnection::OnInputStreamReady(nsIAsyncInputStream* aStream)
+{
+  char buf[4096];
+  uint32_t count;
+  nsresult rv = aStream->Read(buf, sizeof(buf), &count);
+  if (rv == NS_BASE_STREAM_WOULD_BLOCK) {
+    return aStream->AsyncWait(this, 0, 0, nullptr);
+  }
+  if (NS_FAILED(rv) || !count) {
+    // The client closed its idle connection, or the server was shut down.
+    Close();
+    return NS_OK;
+  }
+  mRequest.Append(buf, count);
+
+  // Requests have no body, so each one ends at its blank line. Answer them in
+  // order; the channel doesn't pipeline, but keep-alive reuses connections.
+  int32_t end;
+  while ((end = mRequest.Find("\r\n\r\n")) != kNotFound) {
+    mRequest.Cut(0, end + 4);
+    mPending.Append(mResponse);
+  }
+
+  rv = Flush();
+  if (NS_FAILED(rv)) {
+    Close();
+    return NS_OK;
+  }
+  return aStream->AsyncWait(this, 0, 0, nullptr);
+}
+
+NS_IMETHODIMP
+HttpServerConnection::OnOutputStreamReady(nsIAsyncOutputStream* aStream)
+{
+  if (NS_FAILED(Flush())) {
+    Close();
+  }
+  return NS_OK;
+}
+
+nsresult
+HttpServerConnection::Flush()
+{
+  while (mWritten < mPending.Length()) {
+    uint32_t count;
+    nsresult rv = mOutput->Write(mPending.get() + mWritten,
+                                 mPending.Length() - mWritten, &count);
+    if (rv == NS_BASE_STREAM_WOULD_BLOCK) {
+      return mOutput->AsyncWait(this, 0, 0, nullptr);
+    }
+    NS_ENSURE_SUCCESS(rv, rv);
+    mWritten += count;
+  }
+  mPending.Truncate();
+  mWritten = 0;
+  return NS_OK;
+}
+
+class HttpServerListener : public nsIServerSocketListener
+{
+public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+  NS_DECL_NSISERVERSOCKETLISTENER
+
+  explicit HttpServerListener(uint32_t aBodySize);
+
+private:
+  virtual ~HttpServerListener() = default;
+
+  nsCString mResponse;
+};
+
+NS_IMPL_ISUPPORTS(HttpServerListener, nsIServerSocketListener)
+
+HttpServerListener::HttpServerListener(uint32_t aBodySize)
+{
+  // Cacheable, so that the second pass can be served from the cache.
+  mResponse.AppendPrintf("HTTP/1.1 200 OK\r\n"
+                         "Content-Type: application/octet-stream\r\n"
+                         "Content-Length: %u\r\n"
+                         "Cache-Control: max-age=3600\r\n"
+                         "\r\n", aBodySize);
+  uint32_t headerLength = mResponse.Length();
+  mResponse.SetLength(headerLength + aBodySize);
+  memset(mResponse.BeginWriting() + headerLength, 'x', aBodySize);
+}
+
+NS_IMETHODIMP
+HttpServerListener::OnSocketAccepted(nsIServerSocket* aServ,
+                                     nsISocketTransport* aTransport)
+{
+  // Run on STS thread. The pending AsyncWait keeps the connection alive.
+  RefPtr<HttpServerConnection> conn =
+    new HttpServerConnection(aTransport, mResponse);
+  nsresult rv = conn->Start();
+  if (NS_FAILED(rv)) {
+    aTransport->Close(rv);
+  }
+  return NS_OK;
+}
+
+NS_IMETHODIMP
+HttpServerListener::OnStopListening(nsIServerSocket* aServ, nsresult aStatus)
+{
+  return NS_OK;
+}
+
+//-----------------------------------------------------------------------------
+// Client side. Everything here runs on the main thread.
+
+// Milliseconds spent in each stage of the loads of one pass. Stages a load
+// didn't go through (a lookup or connect on a reused connection, a cache read
+// on a network load) aren't recorded for it.
+struct LoadStages
+{
+  std::vector<double> mDNS;
+  std::vector<double> mConnect;
+  std::vector<double> mFirstByte;
+  std::vector<double> mCacheRead;
+  std::vector<double> mTotal;
+  uint64_t mBytes = 0;
+  uint32_t mFailed = 0;
+};
+
+static void
+AddStage(std::vector<double>& aStage, const TimeStamp& aStart,
+         const TimeStamp& aEnd)
+{
+  if (!aStart.IsNull() && !aEnd.IsNull()) {
+    aStage.push_back((aEnd - aStart).ToMilliseconds());
+  }
+}
+
+class BenchLoader : public nsIStreamListener
+{
+public:
+  NS_DECL_ISUPPORTS
+  NS_DECL_NSIREQUESTOBSERVER
+  NS_DECL_NSISTREAMLISTENER
+
+  BenchLoader(WaitForCondition* aWaiter, int32_t aPort, uint32_t aLoads,
+              LoadStages& aStages);
+
+  // Starts the next load, if there are any left. Loads that fail to start
+  // are counted as failed and completed straight away.
+  void LoadNext();
+
+private:
+  virtual ~BenchLoader() = default;
+
+  nsresult StartLoad(uint32_t aIndex);
+
+  RefPtr<WaitForCondition> mWaiter;
+  const int32_t mPort;
+  const uint32_t mLoads;
+  uint32_t mStarted;
+  LoadStages& mStages;
+};
+
+NS_IMPL_ISUPPORTS(BenchLoader, nsIStreamListener, nsIRequestObserver)
+
+BenchLoader::BenchLoader(WaitForCondition* aWaiter, int32_t aPort,
+                         uint32_t aLoads, LoadStages& aStages)
+  : mWaiter(aWaiter)
+  , mPort(aPort)
+  , mLoads(aLoads)
+  , mStarted(0)
+  , mStages(aStages)
+{
+}
+
+void
+BenchLoader::LoadNext()
+{
+  while (mStarted < mLoads) {
+    if (NS_SUCCEEDED(StartLoad(mStarted++))) {
+      return;
+    }
+    mStages.mFailed++;
+    mWaiter->Notify();
+  }
+}
+
+nsresult
+BenchLoader::StartLoad(uint32_t aIndex)
+{
+  // Each load has its own URL, so that both passes see the same set of cache
+  // entries.
+  nsCOMPtr<nsIURI> uri;
+  nsresult rv = NS_NewURI(getter_AddRefs(uri),
+                          nsPrintfCString("http://127.0.0.1:%d/load/%u",
+                                          mPort, aIndex));
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  nsCOMPtr<nsIChannel> channel;
+  rv = NS_NewChannel(getter_AddRefs(channel), uri,
+                     nsContentUtils::GetSystemPrincipal(),
+                     nsILoadInfo::SEC_ALLOW_CROSS_ORIGIN_DATA_IS_NULL,
+                     nsIContentPolicy::TYPE_OTHER);
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  nsCOMPtr<nsITimedChannel> timed = do_QueryInterface(channel);
+  NS_ENSURE_TRUE(timed, NS_ERROR_NO_INTERFACE);
+  timed->SetTimingEnabled(true);
+
+  return channel->AsyncOpen2(this);
+}
+
+NS_IMETHODIMP
+BenchLoader::OnStartRequest(nsIRequest* aRequest, nsISupports* aContext)
+{
+  return NS_OK;
+}
+
+NS_IMETHODIMP
+BenchLoader::OnDataAvailable(nsIRequest* aRequest, nsISupports* aContext,
+                             nsIInputStream* aStream, uint64_t aOffset,
+                             uint32_t aCount)
+{
+  uint32_t read;
+  nsresult rv = aStream->ReadSegments(NS_DiscardSegment, nullptr, aCount,
+                                      &read);
+  NS_ENSURE_SUCCESS(rv, rv);
+  mStages.mBytes += read;
+  return NS_OK;
+}
+
+NS_IMETHODIMP
+BenchLoader::OnStopRequest(nsIRequest* aRequest, nsISupports* aContext,
+                           nsresult aStatus)
+{
+  nsCOMPtr<nsITimedChannel> timed = do_QueryInterface(aRequest);
+  if (NS_FAILED(aStatus) || !timed) {
+    mStages.mFailed++;
+  } else {
+    TimeStamp asyncOpen, lookupStart, lookupEnd, connectStart, connectEnd,
+              requestStart, responseStart, responseEnd, cacheReadStart,
+              cacheReadEnd;
+    timed->GetAsyncOpen(&asyncOpen);
+    timed->GetDomainLookupStart(&lookupStart);
+    timed->GetDomainLookupEnd(&lookupEnd);
+    timed->GetConnectStart(&connectStart);
+    timed->GetConnectEnd(&connectEnd);
+    timed->GetRequestStart(&requestStart);
+    timed->GetResponseStart(&responseStart);
+    timed->GetResponseEnd(&responseEnd);
+    timed->GetCacheReadStart(&cacheReadStart);
+    timed->GetCacheReadEnd(&cacheReadEnd);
+
+    AddStage(mStages.mDNS, lookupStart, lookupEnd);
+    if (connectStart != connectEnd) {
+      AddStage(mStages.mConnect, connectStart, connectEnd);
+    }
+    AddStage(mStages.mFirstByte, requestStart, responseStart);
+    AddStage(mStages.mCacheRead, cacheReadStart, cacheReadEnd);
+    AddStage(mStages.mTotal, asyncOpen,
+             responseEnd.IsNull() ? cacheReadEnd : responseEnd);
+  }
+
+  mWaiter->Notify();
+  LoadNext();
+  return NS_OK;
+}
+
+static void
+ReportStage(const char* aPass, const char* aStage,
+            std::vector<double>& aSamples)
+{
+  if (aSamples.empty()) {
+    printf("TestHttpLoopback: %-8s %-10s n/a\n", aPass, aStage);
+    return;
+  }
+  std::sort(aSamples.begin(), aSamples.end());
+  auto percentile = [&](double p) {
+    size_t index = size_t(p * aSamples.size());
+    return aSamples[std::min(index, aSamples.size() - 1)];
+  };
+  printf("TestHttpLoopback: %-8s %-10s p50 %8.3f ms  p99 %8.3f ms  (n=%zu)\n",
+         aPass, aStage, percentile(0.5), percentile(0.99), aSamples.size());
+}
+
+static void
+RunPass(const char* aPass, int32_t aPort, uint32_t aLoads,
+        uint32_t aConcurrency, uint32_t aBodySize)
+{
+  RefPtr<WaitForCondition> waiter = new WaitForCondition();
+  LoadStages stages;
+  RefPtr<BenchLoader> loader =
+    new BenchLoader(waiter, aPort, aLoads, stages);
+
+  TimeStamp start = TimeStamp::Now();
+  for (uint32_t i = 0; i < std::min(aLoads, aConcurrency); i++) {
+    loader->LoadNext();
+  }
+  waiter->Wait(aLoads);
+  double seconds = (TimeStamp::Now() - start).ToSeconds();
+
+  EXPECT_EQ(stages.mFailed, 0u);
+  EXPECT_EQ(stages.mBytes, uint64_t(aLoads) * aBodySize);
+
+  ReportStage(aPass, "dns", stages.mDNS);
+  ReportStage(aPass, "connect", stages.mConnect);
+  ReportStage(aPass, "firstbyte", stages.mFirstByte);
+  ReportStage(aPass, "cacheread", stages.mCacheRead);
+  ReportStage(aPass, "total", stages.mTotal);
+  printf("TestHttpLoopback: %-8s %u loads, concurrency %u, %.2f MB/s\n",
+         aPass, aLoads, aConcurrency,
+         seconds > 0 ? stages.mBytes / seconds / (1024 * 1024) : 0.0);
+}
+
+TEST(TestHttpLoopback, DISABLED_Bench)
+{
+  uint32_t loads = GetEnvUint("MOZ_NECKO_BENCH_LOADS", 100);
+  uint32_t concurrency = GetEnvUint("MOZ_NECKO_BENCH_CONCURRENCY", 6);
+  uint32_t bodySize = GetEnvUint("MOZ_NECKO_BENCH_BODY_SIZE", 64 * 1024);
+
+  nsCOMPtr<nsIServerSocket> server =
+    do_CreateInstance("@mozilla.org/network/server-socket;1");
+  ASSERT_TRUE(server);
+
+  nsresult rv = server->Init(-1, true, -1);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  int32_t port;
+  rv = server->GetPort(&port);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  RefPtr<HttpServerListener> listener = new HttpServerListener(bodySize);
+  rv = server->AsyncListen(listener);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  RunPass("network", port, loads, concurrency, bodySize);
+  RunPass("cached", port, loads, concurrency, bodySize);
+
+  server->Close();
+}
@@ -0,0 +1,136 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "TestCommon.h"
+#include "gtest/gtest.h"
+#include "nsISocketTransportService.h"
+#include "nsISocketTransport.h"
+#include "nsIServerSocket.h"
+#include "nsIAsyncInputStream.h"
+#include "nsComponentManagerUtils.h"
+#include "nsServiceManagerUtils.h"
+
+using namespace mozilla;
+
+class TimeoutServerListener : public nsIServerSocketListener
+{
+public:
+  NS_DECL_ISUPPORTS
+  NS_DECL_NSISERVERSOCKETLISTENER
+
+  explicit TimeoutServerListener(WaitForCondition* waiter)
+    : mWaiter(waiter)
+  {
+  }
+
+  // Keep the accepted connection open, without ever writing to it, so that
+  // the only way the client can get woken up is through its timeout.
+  nsCOMPtr<nsISocketTransport> mTransport;
+  RefPtr<WaitForCondition> mWaiter;
+private:
+  virtual ~TimeoutServerListener() = default;
+};
+
+NS_IMPL_ISUPPORTS(TimeoutServerListener, nsIServerSocketListener)
+
+NS_IMETHODIMP
+TimeoutServerListener::OnSocketAccepted(nsIServerSocket *aServ,
+                                        nsISocketTransport *aTransport)
+{
+  mTransport = aTransport;
+  mWaiter->Notify();
+  return NS_OK;
+}
+
+NS_IMETHODIMP
+TimeoutServerListener::OnStopListening(nsIServerSocket *aServ,
+                                       nsresult aStatus)
+{
+  return NS_OK;
+}
+
+class TimeoutInputCallback : public nsIInputStreamCallback
+{
+public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+  NS_DECL_NSIINPUTSTREAMCALLBACK
+
+  explicit TimeoutInputCallback(WaitForCondition* waiter)
+    : mStatus(NS_OK)
+    , mWaiter(waiter)
+  {
+  }
+
+  nsresult mStatus;
+  RefPtr<WaitForCondition> mWaiter;
+private:
+  virtual ~TimeoutInputCallback() = default;
+};
+
+NS_IMPL_ISUPPORTS(TimeoutInputCallback, nsIInputStreamCallback)
+
+NS_IMETHODIMP
+TimeoutInputCallback::OnInputStreamReady(nsIAsyncInputStream *aStream)
+{
+  uint64_t avail;
+  mStatus = aStream->Available(&avail);
+  mWaiter->Notify();
+  return NS_OK;
+}
+
+// A read/write timeout of 0 leaves the connected socket at its timeout as
+// soon as it is polled, so PR_Poll returns immediately with nothing ready.
+// The socket thread must still fire the timeout rather than spin.
+TEST(TestSocketTimeout, ExpiredTimeoutFires)
+{
+  nsCOMPtr<nsIServerSocket> server = do_CreateInstance("@mozilla.org/network/server-socket;1");
+  ASSERT_TRUE(server);
+
+  nsresult rv = server->Init(-1, true, -1);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  int32_t serverPort;
+  rv = server->GetPort(&serverPort);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  RefPtr<WaitForCondition> waiter = new WaitForCondition();
+
+  RefPtr<TimeoutServerListener> serverListener =
+    new TimeoutServerListener(waiter);
+  rv = server->AsyncListen(serverListener);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  nsCOMPtr<nsISocketTransportService> sts =
+    do_GetService("@mozilla.org/network/socket-transport-service;1", &rv);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  nsCOMPtr<nsISocketTransport> client;
+  rv = sts->CreateTransport(nullptr, 0, NS_LITERAL_CSTRING("127.0.0.1"),
+                            serverPort, nullptr, getter_AddRefs(client));
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  rv = client->SetTimeout(nsISocketTransport::TIMEOUT_READ_WRITE, 0);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  nsCOMPtr<nsIInputStream> inputStream;
+  rv = client->OpenInputStream(nsITransport::OPEN_UNBUFFERED,
+                               0, 0, getter_AddRefs(inputStream));
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  RefPtr<TimeoutInputCallback> clientCallback =
+    new TimeoutInputCallback(waiter);
+  nsCOMPtr<nsIAsyncInputStream> asyncInputStream = do_QueryInterface(inputStream);
+  rv = asyncInputStream->AsyncWait(clientCallback, 0, 0, nullptr);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  // One notification for the accept, one for the client's input callback.
+  waiter->Wait(2);
+
+  ASSERT_TRUE(serverListener->mTransport);
+  ASSERT_EQ(clientCallback->mStatus, NS_ERROR_NET_TIMEOUT);
+
+  inputStream->Close();
+  serverListener->mTransport->Close(NS_OK);
+  server->Close();
+}
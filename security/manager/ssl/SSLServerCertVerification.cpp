@@ -94,6 +94,7 @@
 
 #include "SSLServerCertVerification.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "BRNameMatchingPolicy.h"
@@ -133,6 +134,7 @@
 #include "nsXPCOMCIDInternal.h"
 #include "pkix/pkix.h"
 #include "pkix/pkixnss.h"
+#include "prsystem.h"
 #include "secerr.h"
 #include "secoidt.h"
 #include "secport.h"
@@ -175,9 +177,19 @@ InitializeSSLServerCertVerificationThreads()
     return;
   }
 
+  // Verifications are CPU bound, but a thread is also blocked for the whole
+  // duration of any OCSP request it makes, so connection storms to sharded
+  // hosts can easily saturate a small pool. Allow two threads per core,
+  // between the old limit of 5 and 16, and keep 5 of them around idle.
+  int32_t numProcessors = PR_GetNumberOfProcessors();
+  uint32_t threadLimit = 5;
+  if (numProcessors > 0) {
+    threadLimit = std::min(std::max(2u * numProcessors, threadLimit), 16u);
+  }
+
   (void) gCertVerificationThreadPool->SetIdleThreadLimit(5);
   (void) gCertVerificationThreadPool->SetIdleThreadTimeout(30 * 1000);
-  (void) gCertVerificationThreadPool->SetThreadLimit(5);
+  (void) gCertVerificationThreadPool->SetThreadLimit(threadLimit);
   (void) gCertVerificationThreadPool->SetName(NS_LITERAL_CSTRING("SSL Cert"));
 }
 
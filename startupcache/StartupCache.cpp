@@ -241,6 +241,12 @@ StartupCache::LoadArchive()
 
   mArchive = new nsZipArchive();
   rv = mArchive->OpenArchive(mFile);
+  if (NS_SUCCEEDED(rv)) {
+    // Most of the entries are read during startup, in roughly the order
+    // they were written, so have the whole file paged in up front rather
+    // than faulting it in one entry at a time.
+    mArchive->WillNeedMapping();
+  }
   return rv;
 }
 
@@ -17,6 +17,18 @@ using mozilla::TimeStamp;
 namespace mozilla {
 void GTestBench(const char* aSuite, const char* aName,
                 const std::function<void()>& aTest)
+{
+  GTestBenchTimed(aSuite, aName, [&aTest] {
+    mozilla::TimeStamp start = TimeStamp::Now();
+
+    aTest();
+
+    return (TimeStamp::Now() - start).ToMicroseconds();
+  });
+}
+
+void GTestBenchTimed(const char* aSuite, const char* aName,
+                     const std::function<double()>& aTest)
 {
 #ifdef DEBUG
   // Run the test to make sure that it doesn't fail but don't log
@@ -27,11 +39,7 @@ void GTestBench(const char* aSuite, const char* aName,
   std::vector<int> durations;
 
   for (int i=0; i<MOZ_GTEST_NUM_ITERATIONS; i++) {
-    mozilla::TimeStamp start = TimeStamp::Now();
-
-    aTest();
-
-    durations.push_back((TimeStamp::Now() - start).ToMicroseconds());
+    durations.push_back(aTest());
   }
 
   std::string replicatesStr = "[" + std::to_string(durations[0]);
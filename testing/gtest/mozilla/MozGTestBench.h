@@ -12,6 +12,10 @@ namespace mozilla {
 
 void GTestBench(const char* aSuite, const char* aName, const std::function<void()>& aTest);
 
+// Like GTestBench, but aTest returns the duration in microseconds to record
+// for its iteration, so that per-iteration setup can be left out of it.
+void GTestBenchTimed(const char* aSuite, const char* aName, const std::function<double()>& aTest);
+
 } //mozilla
 
 #define MOZ_GTEST_BENCH(suite, test, lambdaOrFunc) \
@@ -19,4 +23,9 @@ TEST(suite, test) { \
   mozilla::GTestBench(#suite, #test, lambdaOrFunc); \
 }
 
+#define MOZ_GTEST_BENCH_TIMED(suite, test, lambdaOrFunc) \
+TEST(suite, test) { \
+  mozilla::GTestBenchTimed(#suite, #test, lambdaOrFunc); \
+}
+
 #endif // GTEST_MOZGTESTBENCH_H
@@ -464,13 +464,22 @@ namespace places {
     // Obtain our search function.
     searchFunctionPtr searchFunction = getSearchFunction(matchBehavior);
 
-    // Clean up our URI spec and prepare it for searching.
+    // Cleaning up the URI spec means unescaping and validating it, so only do
+    // it the first time a token actually needs to be searched for in the URL;
+    // many rows are decided on the title or tags alone.
     nsCString fixedUrlBuf;
-    nsDependentCSubstring fixedUrl =
-      fixupURISpec(url, matchBehavior, fixedUrlBuf);
-    // Limit the number of chars we search through.
-    const nsDependentCSubstring& trimmedUrl =
-      Substring(fixedUrl, 0, MAX_CHARS_TO_SEARCH_THROUGH);
+    nsDependentCSubstring trimmedUrl;
+    bool urlFixedUp = false;
+    auto searchUrl = [&](const nsDependentCSubstring& aToken) {
+      if (!urlFixedUp) {
+        nsDependentCSubstring fixedUrl =
+          fixupURISpec(url, matchBehavior, fixedUrlBuf);
+        // Limit the number of chars we search through.
+        trimmedUrl.Rebind(fixedUrl, 0, MAX_CHARS_TO_SEARCH_THROUGH);
+        urlFixedUp = true;
+      }
+      return searchFunction(aToken, trimmedUrl);
+    };
 
     nsDependentCString title = getSharedString(aArguments, kArgIndexTitle);
     // Limit the number of chars we search through.
@@ -486,19 +495,19 @@ namespace places {
       if (HAS_BEHAVIOR(TITLE) && HAS_BEHAVIOR(URL)) {
         matches = (searchFunction(token, trimmedTitle) ||
                    searchFunction(token, tags)) &&
-                  searchFunction(token, trimmedUrl);
+                  searchUrl(token);
       }
       else if (HAS_BEHAVIOR(TITLE)) {
         matches = searchFunction(token, trimmedTitle) ||
                   searchFunction(token, tags);
       }
       else if (HAS_BEHAVIOR(URL)) {
-        matches = searchFunction(token, trimmedUrl);
+        matches = searchUrl(token);
       }
       else {
         matches = searchFunction(token, trimmedTitle) ||
                   searchFunction(token, tags) ||
-                  searchFunction(token, trimmedUrl);
+                  searchUrl(token);
       }
     }
 
@@ -3137,9 +3137,12 @@ nsNavHistory::DecayFrecency()
   // original value after 28 days.
   // When changing the scaling factor, ensure that the barrier in
   // moz_places_afterupdate_frecency_trigger still ignores these changes.
+  // Small frecencies round back to themselves, so every page that isn't
+  // visited for a while ends up at the same fixed point; skip those rather
+  // than rewriting most of moz_places with unchanged values every day.
   nsCOMPtr<mozIStorageAsyncStatement> decayFrecency = mDB->GetAsyncStatement(
     "UPDATE moz_places SET frecency = ROUND(frecency * :decay_rate) "
-    "WHERE frecency > 0"
+    "WHERE frecency > 0 AND ROUND(frecency * :decay_rate) <> frecency"
   );
   NS_ENSURE_STATE(decayFrecency);
 
@@ -190,9 +190,11 @@ namespace {
 bool gInitDone = false;
 
 // Whether we are collecting the base, opt-out, Histogram data.
-bool gCanRecordBase = false;
+// These two are only written under |gTelemetryHistogramMutex|, but are
+// atomic so that the accumulation fast path can read them without it.
+mozilla::Atomic<bool, mozilla::Relaxed> gCanRecordBase(false);
 // Whether we are collecting the extended, opt-in, Histogram data.
-bool gCanRecordExtended = false;
+mozilla::Atomic<bool, mozilla::Relaxed> gCanRecordExtended(false);
 
 // The storage for actual Histogram instances.
 // We use separate ones for plain and keyed histograms.
@@ -893,6 +895,21 @@ static StaticMutex gTelemetryHistogramMutex;
 
 namespace {
 
+// NOTE: Runs without protection from |gTelemetryHistogramMutex|.
+// Returns true if an accumulation to |aId| in this process would be
+// dropped by internal_HistogramAdd or KeyedHistogram::Add anyway, so that
+// callers can return before taking the lock. On release builds this is
+// the common case for opt-in histograms. Child processes always take the
+// lock, as their recording state is checked in the parent.
+bool
+internal_ShouldSkipAccumulate(HistogramID aId)
+{
+  return XRE_IsParentProcess() &&
+         !CanRecordDataset(gHistogramInfos[aId].dataset,
+                           internal_CanRecordBase(),
+                           internal_CanRecordExtended());
+}
+
 bool
 internal_RemoteAccumulate(HistogramID aId, uint32_t aSample)
 {
@@ -1820,6 +1837,10 @@ TelemetryHistogram::Accumulate(HistogramID aID,
     return;
   }
 
+  if (internal_ShouldSkipAccumulate(aID)) {
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   internal_Accumulate(aID, aSample);
 }
@@ -1845,6 +1866,10 @@ TelemetryHistogram::Accumulate(HistogramID aID,
     return;
   }
 
+  if (internal_ShouldSkipAccumulate(aID)) {
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   internal_Accumulate(aID, aKey, aSample);
 }
@@ -1907,6 +1932,10 @@ TelemetryHistogram::AccumulateCategorical(HistogramID aId,
     return;
   }
 
+  if (internal_ShouldSkipAccumulate(aId)) {
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   if (!internal_CanRecordBase()) {
     return;
@@ -200,6 +200,41 @@ AppendPrefixToMap(PrefixStringMap& prefixes, nsDependentCSubstring& prefix)
   return NS_OK;
 }
 
+// Size each output prefix string up front so that merging doesn't keep
+// reallocating and copying buffers that can hold hundreds of thousands of
+// prefixes. Removals only make the result smaller, so old plus added is an
+// upper bound.
+static nsresult
+ReserveOutputMap(const PrefixStringMap& aInputMap,
+                 const TableUpdateV4::PrefixStdStringMap& aAddMap,
+                 PrefixStringMap& aOutputMap)
+{
+  for (auto iter = aInputMap.ConstIter(); !iter.Done(); iter.Next()) {
+    uint32_t size = iter.Data()->Length();
+    const TableUpdateV4::PrefixStdString* add = aAddMap.Get(iter.Key());
+    if (add) {
+      size += add->GetPrefixString().Length();
+    }
+    nsCString* prefixString = aOutputMap.LookupOrAdd(iter.Key());
+    if (!prefixString->SetCapacity(size, fallible)) {
+      return NS_ERROR_OUT_OF_MEMORY;
+    }
+  }
+
+  for (auto iter = aAddMap.ConstIter(); !iter.Done(); iter.Next()) {
+    if (aInputMap.Get(iter.Key())) {
+      continue;
+    }
+    nsCString* prefixString = aOutputMap.LookupOrAdd(iter.Key());
+    if (!prefixString->SetCapacity(iter.Data()->GetPrefixString().Length(),
+                                   fallible)) {
+      return NS_ERROR_OUT_OF_MEMORY;
+    }
+  }
+
+  return NS_OK;
+}
+
 // Read prefix into a buffer and also update the hash which
 // keeps track of the checksum
 static void
@@ -231,6 +266,11 @@ LookupCacheV4::ApplyUpdate(TableUpdateV4* aTableUpdate,
   VLPrefixSet oldPSet(aInputMap);
   VLPrefixSet addPSet(aTableUpdate->Prefixes());
 
+  rv = ReserveOutputMap(aInputMap, aTableUpdate->Prefixes(), aOutputMap);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
   // RemovalIndiceArray is a sorted integer array indicating the index of prefix we should
   // remove from the old prefix set(according to lexigraphic order).
   // |removalIndex| is the current index of RemovalIndiceArray.
@@ -320,6 +360,14 @@ LookupCacheV4::ApplyUpdate(TableUpdateV4* aTableUpdate,
     return NS_ERROR_UC_UPDATE_WRONG_REMOVAL_INDICES;
   }
 
+  // Drop any prefix sizes that were reserved but ended up with every prefix
+  // removed, so the output only holds sizes that actually have prefixes.
+  for (auto iter = aOutputMap.Iter(); !iter.Done(); iter.Next()) {
+    if (iter.Data()->IsEmpty()) {
+      iter.Remove();
+    }
+  }
+
   nsAutoCString checksum;
   crypto->Finish(false, checksum);
   if (aTableUpdate->Checksum().IsEmpty()) {
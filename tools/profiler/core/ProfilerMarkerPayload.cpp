@@ -83,6 +83,19 @@ IOMarkerPayload::StreamPayload(SpliceableJSONWriter& aWriter,
   }
 }
 
+void
+NetworkMarkerPayload::StreamPayload(SpliceableJSONWriter& aWriter,
+                                    const TimeStamp& aProcessStartTime,
+                                    UniqueStacks& aUniqueStacks)
+{
+  StreamCommonProps("Network", aWriter, aProcessStartTime, aUniqueStacks);
+  aWriter.IntProperty("id", int64_t(mID));
+  if (mURI) {
+    aWriter.StringProperty("URI", mURI.get());
+  }
+  aWriter.IntProperty("status", int64_t(uint32_t(mStatus)));
+}
+
 void
 UserTimingMarkerPayload::StreamPayload(SpliceableJSONWriter& aWriter,
                                        const TimeStamp& aProcessStartTime,
@@ -125,6 +125,29 @@ private:
   mozilla::UniqueFreePtr<char> mFilename;
 };
 
+// One HTTP channel's lifetime, from AsyncOpen to OnStopRequest. The ID is the
+// channel ID, which the parent and child halves of an e10s channel share, so
+// the two markers can be matched up across processes.
+class NetworkMarkerPayload : public ProfilerMarkerPayload
+{
+public:
+  NetworkMarkerPayload(uint64_t aID, const char* aURI, nsresult aStatus,
+                       const mozilla::TimeStamp& aStartTime,
+                       const mozilla::TimeStamp& aEndTime)
+    : ProfilerMarkerPayload(aStartTime, aEndTime)
+    , mID(aID)
+    , mURI(aURI ? strdup(aURI) : nullptr)
+    , mStatus(aStatus)
+  {}
+
+  DECL_STREAM_PAYLOAD
+
+private:
+  uint64_t mID;
+  mozilla::UniqueFreePtr<char> mURI;
+  nsresult mStatus;
+};
+
 class DOMEventMarkerPayload : public ProfilerMarkerPayload
 {
 public:
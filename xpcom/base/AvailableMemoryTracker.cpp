@@ -21,6 +21,7 @@
 
 #include "mozilla/Preferences.h"
 #include "mozilla/Services.h"
+#include "mozilla/SharedThreadPool.h"
 
 #if defined(XP_WIN)
 #   include "nsWindowsDllInterceptor.h"
@@ -284,10 +285,9 @@ NS_IMPL_ISUPPORTS(LowEventsReporter, nsIMemoryReporter)
 #endif // defined(_M_IX86) && defined(XP_WIN)
 
 /**
- * This runnable is executed in response to a memory-pressure event; we spin
- * the event-loop when receiving the memory-pressure event in the hope that
- * other observers will synchronously free some memory that we'll be able to
- * purge here.
+ * This runnable frees the dirty pages held by jemalloc. Purging takes every
+ * arena lock in turn and issues a system call per dirty run, so it runs on a
+ * background thread rather than stalling the thread that asked for it.
  */
 class nsJemallocFreeDirtyPagesRunnable final : public nsIRunnable
 {
@@ -296,6 +296,8 @@ class nsJemallocFreeDirtyPagesRunnable final : public nsIRunnable
 public:
   NS_DECL_ISUPPORTS
   NS_DECL_NSIRUNNABLE
+
+  static void Dispatch();
 };
 
 NS_IMPL_ISUPPORTS(nsJemallocFreeDirtyPagesRunnable, nsIRunnable)
@@ -303,7 +305,7 @@ NS_IMPL_ISUPPORTS(nsJemallocFreeDirtyPagesRunnable, nsIRunnable)
 NS_IMETHODIMP
 nsJemallocFreeDirtyPagesRunnable::Run()
 {
-  MOZ_ASSERT(NS_IsMainThread());
+  MOZ_ASSERT(!NS_IsMainThread());
 
 #if defined(MOZ_MEMORY)
   jemalloc_free_dirty_pages();
@@ -312,10 +314,26 @@ nsJemallocFreeDirtyPagesRunnable::Run()
   return NS_OK;
 }
 
+/* static */ void
+nsJemallocFreeDirtyPagesRunnable::Dispatch()
+{
+  // The pool goes away once the purge is done, so no thread lingers waiting
+  // for the next one.
+  RefPtr<SharedThreadPool> pool =
+    SharedThreadPool::Get(NS_LITERAL_CSTRING("JemallocPurge"), 1);
+  if (NS_WARN_IF(!pool)) {
+    return;
+  }
+  nsCOMPtr<nsIRunnable> runnable = new nsJemallocFreeDirtyPagesRunnable();
+  pool->Dispatch(runnable.forget(), NS_DISPATCH_NORMAL);
+}
+
 /**
  * The memory pressure watcher is used for listening to memory-pressure events
  * and reacting upon them. We use one instance per process currently only for
- * cleaning up dirty unused pages held by jemalloc.
+ * cleaning up dirty unused pages held by jemalloc, both under memory pressure
+ * and, so that they don't pile up over a long session, once the user stops
+ * interacting with the browser.
  */
 class nsMemoryPressureWatcher final : public nsIObserver
 {
@@ -329,11 +347,13 @@ public:
 
 private:
   static bool sFreeDirtyPages;
+  static bool sFreeDirtyPagesWhenInactive;
 };
 
 NS_IMPL_ISUPPORTS(nsMemoryPressureWatcher, nsIObserver)
 
 bool nsMemoryPressureWatcher::sFreeDirtyPages = false;
+bool nsMemoryPressureWatcher::sFreeDirtyPagesWhenInactive = false;
 
 /**
  * Initialize and subscribe to the memory-pressure events. We subscribe to the
@@ -347,26 +367,38 @@ nsMemoryPressureWatcher::Init()
 
   if (os) {
     os->AddObserver(this, "memory-pressure", /* ownsWeak */ false);
+    os->AddObserver(this, "user-interaction-inactive", /* ownsWeak */ false);
   }
 
   Preferences::AddBoolVarCache(&sFreeDirtyPages, "memory.free_dirty_pages",
                                false);
+  Preferences::AddBoolVarCache(&sFreeDirtyPagesWhenInactive,
+                               "memory.free_dirty_pages_when_inactive", false);
 }
 
 /**
- * Reacts to all types of memory-pressure events, launches a runnable to
- * free dirty pages held by jemalloc.
+ * Reacts to all types of memory-pressure events, and to the user going
+ * inactive, by launching a runnable to free dirty pages held by jemalloc.
  */
 NS_IMETHODIMP
 nsMemoryPressureWatcher::Observe(nsISupports* aSubject, const char* aTopic,
                                  const char16_t* aData)
 {
-  MOZ_ASSERT(!strcmp(aTopic, "memory-pressure"), "Unknown topic");
-
-  if (sFreeDirtyPages) {
-    nsCOMPtr<nsIRunnable> runnable = new nsJemallocFreeDirtyPagesRunnable();
-
-    NS_DispatchToMainThread(runnable);
+  if (!strcmp(aTopic, "memory-pressure")) {
+    if (sFreeDirtyPages) {
+      // Spin the event loop once before purging, in the hope that other
+      // observers will synchronously free some memory that we'll be able to
+      // purge.
+      NS_DispatchToMainThread(NS_NewRunnableFunction(
+        "nsMemoryPressureWatcher::FreeDirtyPages",
+        &nsJemallocFreeDirtyPagesRunnable::Dispatch));
+    }
+  } else if (!strcmp(aTopic, "user-interaction-inactive")) {
+    if (sFreeDirtyPagesWhenInactive) {
+      nsJemallocFreeDirtyPagesRunnable::Dispatch();
+    }
+  } else {
+    MOZ_ASSERT_UNREACHABLE("Unknown topic");
   }
 
   return NS_OK;
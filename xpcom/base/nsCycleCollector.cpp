@@ -3330,6 +3330,10 @@ nsCycleCollector::CollectWhite()
     nsCycleCollectionParticipant* zoneParticipant =
       hasJSRuntime ? mCCJSRuntime->ZoneParticipant() : nullptr;
 
+    // White JS things tend to come in long runs from the same zone, so avoid
+    // hitting the zone set for every one of them.
+    JS::Zone* lastZone = nullptr;
+
     NodePool::Enumerator etor(mGraph.mNodes);
     while (!etor.IsDone()) {
       PtrInfo* pinfo = etor.GetNext();
@@ -3345,7 +3349,10 @@ nsCycleCollector::CollectWhite()
             JS::GCCellPtr ptr(pinfo->mPointer, JS::GCThingTraceKind(pinfo->mPointer));
             zone = JS::GetTenuredGCThingZone(ptr);
           }
-          mCCJSRuntime->AddZoneWaitingForGC(zone);
+          if (zone != lastZone) {
+            mCCJSRuntime->AddZoneWaitingForGC(zone);
+            lastZone = zone;
+          }
         } else {
           whiteNodes.InfallibleAppend(pinfo);
           pinfo->mParticipant->Root(pinfo->mPointer);
@@ -3532,9 +3539,19 @@ void
 nsCycleCollector::SuspectNurseryEntries()
 {
   MOZ_ASSERT(NS_IsMainThread(), "Wrong thread!");
+  bool idle = IsIdle();
   while (gNurseryPurpleBufferEntryCount) {
     NurseryPurpleBufferEntry& entry =
       gNurseryPurpleBufferEntry[--gNurseryPurpleBufferEntryCount];
+    // Objects that have been AddRef'ed since they were suspected are no
+    // longer purple and would just be dropped again by the next
+    // forgetSkippable or CC, so don't bother moving them to the purple buffer.
+    // During an incremental CC, though, every buffered object is treated as
+    // an incremental root, so they must all be kept.
+    if (idle && entry.mRefCnt->get() && !entry.mRefCnt->IsPurple()) {
+      entry.mRefCnt->RemoveFromPurpleBuffer();
+      continue;
+    }
     mPurpleBuf.Put(entry.mPtr, entry.mParticipant, entry.mRefCnt);
   }
 }
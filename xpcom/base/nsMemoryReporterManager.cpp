@@ -1302,6 +1302,9 @@ public:
   NS_IMETHOD CollectReports(nsIHandleReportCallback* aHandleReport,
                             nsISupports* aData, bool aAnonymize) override
   {
+    // These totals include the private arenas created by moz_create_arena().
+    // They aren't reported separately; a subsystem that creates one should
+    // add its own reporter once it needs the breakdown.
     jemalloc_stats_t stats;
     jemalloc_stats(&stats);
 
@@ -43,6 +43,9 @@ public:
   constexpr ArenaAllocator()
     : mHead()
     , mCurrent(nullptr)
+#ifdef DEBUG
+    , mUserCount(0)
+#endif
   {
      static_assert(mozilla::tl::FloorLog2<Alignment>::value ==
                    mozilla::tl::CeilingLog2<Alignment>::value,
@@ -90,6 +93,9 @@ public:
    */
   void Clear()
   {
+    MOZ_ASSERT(!mUserCount,
+               "Containers using this arena must be gone before it is cleared");
+
     // Free all chunks.
     auto a = mHead.next;
     while (a) {
@@ -121,6 +127,20 @@ public:
     return s;
   }
 
+#ifdef DEBUG
+  /**
+   * Tracks the objects, such as ArenaAllocPolicy instances, that hand out
+   * memory from this arena on behalf of a longer-lived owner, so that clearing
+   * or destroying the arena under them asserts.
+   */
+  void AddUser() { mUserCount++; }
+  void RemoveUser()
+  {
+    MOZ_ASSERT(mUserCount);
+    mUserCount--;
+  }
+#endif
+
 private:
   struct ArenaHeader
   {
@@ -217,6 +237,9 @@ private:
 
   ArenaChunk mHead;
   ArenaChunk* mCurrent;
+#ifdef DEBUG
+  size_t mUserCount;
+#endif
 };
 
 } // namespace mozilla
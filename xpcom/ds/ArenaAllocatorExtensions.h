@@ -89,6 +89,119 @@ T* detail::DuplicateString(const T* aSrc, const CheckedInt<size_t>& aLen,
   return p;
 }
 
+/**
+ * An allocation policy, suitable for mozilla::Vector and other containers
+ * parameterized on an AllocPolicy, that draws memory from an ArenaAllocator.
+ * Memory is only released when the arena is cleared or destroyed, so this is
+ * meant for short-lived temporaries that would otherwise hit the heap many
+ * times. The arena must outlive every container using the policy; debug builds
+ * assert this when the arena is cleared or destroyed.
+ *
+ * Example usage:
+ *
+ * ArenaAllocator<4096, 8> arena;
+ * Vector<nsIFrame*, 16, ArenaAllocPolicy<4096, 8>> frames(arena);
+ */
+template<size_t ArenaSize, size_t Alignment>
+class ArenaAllocPolicy
+{
+public:
+  MOZ_IMPLICIT ArenaAllocPolicy(ArenaAllocator<ArenaSize, Alignment>& aArena)
+    : mArena(aArena)
+  {
+#ifdef DEBUG
+    mArena.AddUser();
+#endif
+  }
+
+  ArenaAllocPolicy(const ArenaAllocPolicy& aOther)
+    : mArena(aOther.mArena)
+  {
+#ifdef DEBUG
+    mArena.AddUser();
+#endif
+  }
+
+  ~ArenaAllocPolicy()
+  {
+#ifdef DEBUG
+    mArena.RemoveUser();
+#endif
+  }
+
+  template<typename T>
+  T* maybe_pod_malloc(size_t aNumElems)
+  {
+    static_assert(Alignment >= alignof(T),
+                  "ArenaAllocPolicy arena is not sufficiently aligned for T");
+    const CheckedInt<size_t> bytes = CheckedInt<size_t>(aNumElems) * sizeof(T);
+    if (!bytes.isValid()) {
+      return nullptr;
+    }
+    // The arena doesn't do zero-sized allocations, but a null result would be
+    // taken for OOM, so hand out a minimal block instead.
+    return static_cast<T*>(mArena.Allocate(std::max(bytes.value(), size_t(1)),
+                                           fallible));
+  }
+
+  template<typename T>
+  T* maybe_pod_calloc(size_t aNumElems)
+  {
+    T* p = maybe_pod_malloc<T>(aNumElems);
+    if (p) {
+      memset(p, 0, aNumElems * sizeof(T));
+    }
+    return p;
+  }
+
+  template<typename T>
+  T* maybe_pod_realloc(T* aPtr, size_t aOldSize, size_t aNewSize)
+  {
+    // Arena memory can't be resized in place, so copy into a fresh block and
+    // leave the old one to be reclaimed with the arena.
+    T* p = maybe_pod_malloc<T>(aNewSize);
+    if (p && aPtr) {
+      memcpy(p, aPtr, std::min(aOldSize, aNewSize) * sizeof(T));
+    }
+    return p;
+  }
+
+  template<typename T>
+  T* pod_malloc(size_t aNumElems)
+  {
+    return maybe_pod_malloc<T>(aNumElems);
+  }
+
+  template<typename T>
+  T* pod_calloc(size_t aNumElems)
+  {
+    return maybe_pod_calloc<T>(aNumElems);
+  }
+
+  template<typename T>
+  T* pod_realloc(T* aPtr, size_t aOldSize, size_t aNewSize)
+  {
+    return maybe_pod_realloc<T>(aPtr, aOldSize, aNewSize);
+  }
+
+  void free_(void* aPtr)
+  {
+    // Arena allocations are released all at once by the arena.
+  }
+
+  void reportAllocOverflow() const
+  {
+  }
+
+  MOZ_MUST_USE bool checkSimulatedOOM() const
+  {
+    return true;
+  }
+
+private:
+  ArenaAllocator<ArenaSize, Alignment>& mArena;
+};
+
 } // namespace mozilla
 
 #endif // mozilla_ArenaAllocatorExtensions_h
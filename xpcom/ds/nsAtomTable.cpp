@@ -556,9 +556,42 @@ typedef nsTHashtable<StaticAtomEntry> StaticAtomTable;
 static StaticAtomTable* gStaticAtomTable = nullptr;
 
 /**
- * Whether it is still OK to add atoms to gStaticAtomTable.
+ * Whether it is still OK to add atoms to gStaticAtomTable. NS_Atomize reads
+ * this without gAtomTableLock, so it is set (with release semantics) only
+ * after gStaticAtomTable and gStaticAtomFilter are complete; a thread that
+ * sees it set also sees them.
  */
-static bool gStaticAtomTableSealed = false;
+static Atomic<bool, ReleaseAcquire> gStaticAtomTableSealed(false);
+
+/**
+ * A two-bit Bloom filter over the hashes of the static atoms, filled in when
+ * gStaticAtomTable is sealed. NS_Atomize only looks up gStaticAtomTable when
+ * the filter matches, so the dynamic atoms it misses don't pay for a second
+ * hash table lookup. With ~2700 static atoms, about one dynamic atom in 150
+ * still gets through.
+ */
+static const uint32_t kStaticAtomFilterBits = 1 << 16;
+static uint32_t gStaticAtomFilter[kStaticAtomFilterBits / 32];
+
+static inline void
+SetStaticAtomFilterBit(uint32_t aBit)
+{
+  aBit %= kStaticAtomFilterBits;
+  gStaticAtomFilter[aBit / 32] |= 1u << (aBit % 32);
+}
+
+static inline bool
+GetStaticAtomFilterBit(uint32_t aBit)
+{
+  aBit %= kStaticAtomFilterBits;
+  return gStaticAtomFilter[aBit / 32] & (1u << (aBit % 32));
+}
+
+static inline bool
+MightBeStaticAtom(uint32_t aHash)
+{
+  return GetStaticAtomFilterBit(aHash) && GetStaticAtomFilterBit(aHash >> 16);
+}
 
 // The atom table very quickly gets 10,000+ entries in it (or even 100,000+).
 // But choosing the best initial length has some subtleties: we add ~2700
@@ -750,11 +783,21 @@ NS_Atomize(const char16_t* aUTF16String)
 already_AddRefed<nsIAtom>
 NS_Atomize(const nsAString& aUTF16String)
 {
+  uint32_t hash = HashString(aUTF16String.Data(), aUTF16String.Length());
+
+  // Once sealed, gStaticAtomTable is never modified again, so static atoms can
+  // be found without taking gAtomTableLock.
+  if (gStaticAtomTableSealed && gStaticAtomTable && MightBeStaticAtom(hash)) {
+    if (StaticAtomEntry* entry = gStaticAtomTable->GetEntry(aUTF16String)) {
+      nsCOMPtr<nsIAtom> atom = entry->mAtom;
+      return atom.forget();
+    }
+  }
+
   MutexAutoLock lock(*gAtomTableLock);
-  uint32_t hash;
-  AtomTableEntry* he = GetAtomHashEntry(aUTF16String.Data(),
-                                        aUTF16String.Length(),
-                                        &hash);
+  AtomTableKey key(aUTF16String.Data(), aUTF16String.Length(), hash);
+  // This is an infallible add.
+  AtomTableEntry* he = static_cast<AtomTableEntry*>(gAtomTable->Add(&key));
 
   if (he->mAtom) {
     nsCOMPtr<nsIAtom> atom = he->mAtom;
@@ -822,5 +865,13 @@ NS_GetStaticAtom(const nsAString& aUTF16String)
 void
 NS_SealStaticAtomTable()
 {
+  MOZ_ASSERT(NS_IsMainThread());
+  if (gStaticAtomTable) {
+    for (auto iter = gStaticAtomTable->Iter(); !iter.Done(); iter.Next()) {
+      uint32_t hash = iter.Get()->mAtom->hash();
+      SetStaticAtomFilterBit(hash);
+      SetStaticAtomFilterBit(hash >> 16);
+    }
+  }
   gStaticAtomTableSealed = true;
 }
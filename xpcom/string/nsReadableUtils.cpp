@@ -596,25 +596,8 @@ AppendUnicodeTo(const nsAString::const_iterator& aSrcStart,
 bool
 IsASCII(const nsAString& aString)
 {
-  static const char16_t NOT_ASCII = char16_t(~0x007F);
-
-
-  // Don't want to use |copy_string| for this task, since we can stop at the first non-ASCII character
-
-  nsAString::const_iterator iter, done_reading;
-  aString.BeginReading(iter);
-  aString.EndReading(done_reading);
-
-  const char16_t* c = iter.get();
-  const char16_t* end = done_reading.get();
-
-  while (c < end) {
-    if (*c++ & NOT_ASCII) {
-      return false;
-    }
-  }
-
-  return true;
+  // Use the word-at-a-time (or SSE2) scan that AppendUTF16toUTF8 relies on.
+  return FirstNonASCII(aString.BeginReading(), aString.EndReading()) == -1;
 }
 
 bool
@@ -657,12 +640,26 @@ IsUTF8(const nsACString& aString, bool aRejectNonChar)
   nsReadingIterator<char> iter;
   aString.BeginReading(iter);
 
+  // Mask of the high bit of every byte in a word, used to skip runs of ASCII.
+  const size_t kHighBitsMask = size_t(UINT64_C(0x8080808080808080));
+  const uintptr_t kAlignMask = sizeof(size_t) - 1;
+
   const char* ptr = iter.get();
   const char* end = done_reading.get();
   while (ptr < end) {
     uint8_t c;
 
     if (0 == state) {
+      // Between characters, consume aligned words of ASCII in one go.
+      while ((uintptr_t(ptr) & kAlignMask) == 0 &&
+             size_t(end - ptr) >= sizeof(size_t) &&
+             !(*reinterpret_cast<const size_t*>(ptr) & kHighBitsMask)) {
+        ptr += sizeof(size_t);
+      }
+      if (ptr == end) {
+        break;
+      }
+
       c = *ptr++;
 
       if (UTF8traits::isASCII(c)) {
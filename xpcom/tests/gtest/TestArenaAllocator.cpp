@@ -6,6 +6,7 @@
 
 #include "mozilla/ArenaAllocator.h"
 #include "mozilla/ArenaAllocatorExtensions.h"
+#include "mozilla/Vector.h"
 #include "nsIMemoryReporter.h" // MOZ_MALLOC_SIZE_OF
 
 #include "gtest/gtest.h"
@@ -296,3 +297,76 @@ TEST(ArenaAllocator, Extensions)
   nsLiteralCString::char_type* cstr = mozilla::ArenaStrdup(cStr, a);
   EXPECT_TRUE(cStr.Equals(cstr));
 }
+
+TEST(ArenaAllocator, AllocPolicy)
+{
+  ArenaAllocator<4096, 8> a;
+  mozilla::Vector<uint64_t, 4, mozilla::ArenaAllocPolicy<4096, 8>> v(a);
+
+  // Grow well past the inline capacity and the arena chunk size.
+  for (uint64_t i = 0; i < 1000; i++) {
+    EXPECT_TRUE(v.append(i));
+  }
+
+  EXPECT_EQ(v.length(), size_t(1000));
+  for (uint64_t i = 0; i < 1000; i++) {
+    EXPECT_EQ(v[i], i);
+  }
+
+  EXPECT_GT(a.SizeOfExcludingThis(TestSizeOf), size_t(0));
+}
+
+TEST(ArenaAllocator, AllocPolicyClear)
+{
+  ArenaAllocator<4096, 8> a;
+
+  {
+    mozilla::Vector<uint64_t, 4, mozilla::ArenaAllocPolicy<4096, 8>> v(a);
+    for (uint64_t i = 0; i < 1000; i++) {
+      EXPECT_TRUE(v.append(i));
+    }
+
+    // Clearing keeps the arena-backed storage, which is reused on regrowth.
+    const uint64_t* storage = v.begin();
+    v.clear();
+    EXPECT_EQ(v.length(), size_t(0));
+    EXPECT_GE(v.capacity(), size_t(1000));
+    for (uint64_t i = 0; i < 1000; i++) {
+      EXPECT_TRUE(v.append(i * 2));
+    }
+    EXPECT_EQ(v.begin(), storage);
+    for (uint64_t i = 0; i < 1000; i++) {
+      EXPECT_EQ(v[i], i * 2);
+    }
+
+    // Shrinking back to the inline storage and growing again also works.
+    v.clearAndFree();
+    EXPECT_EQ(v.capacity(), size_t(4));
+    for (uint64_t i = 0; i < 100; i++) {
+      EXPECT_TRUE(v.append(i));
+    }
+    EXPECT_EQ(v.length(), size_t(100));
+    EXPECT_EQ(v[99], uint64_t(99));
+  }
+
+  // The vector is gone, so the arena can be cleared and reused.
+  a.Clear();
+  mozilla::Vector<uint64_t, 0, mozilla::ArenaAllocPolicy<4096, 8>> w(a);
+  EXPECT_TRUE(w.append(1));
+  EXPECT_EQ(w[0], uint64_t(1));
+}
+
+TEST(ArenaAllocator, AllocPolicyZeroSize)
+{
+  ArenaAllocator<4096, 8> a;
+  mozilla::ArenaAllocPolicy<4096, 8> policy(a);
+
+  // A zero-element request must not look like OOM.
+  uint64_t* p = policy.maybe_pod_malloc<uint64_t>(0);
+  EXPECT_TRUE(p);
+  uint64_t* q = policy.maybe_pod_calloc<uint64_t>(0);
+  EXPECT_TRUE(q);
+  uint64_t* r = policy.maybe_pod_realloc<uint64_t>(p, 0, 0);
+  EXPECT_TRUE(r);
+  EXPECT_EQ(uintptr_t(r) % 8, uintptr_t(0));
+}
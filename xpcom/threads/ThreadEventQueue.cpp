@@ -98,7 +98,11 @@ ThreadEventQueue<InnerQueueT>::PutEventInternal(already_AddRefed<nsIRunnable>&&
       mBaseQueue->PutEvent(event.take(), aPriority, lock);
     }
 
-    mEventsAvailable.Notify();
+    // There is no point in signalling the condition variable unless somebody
+    // is actually blocked in GetEvent.
+    if (mWaiters) {
+      mEventsAvailable.Notify();
+    }
 
     // Make sure to grab the observer before dropping the lock, otherwise the
     // event that we just placed into the queue could run and eventually delete
@@ -135,7 +139,9 @@ ThreadEventQueue<InnerQueueT>::GetEvent(bool aMayWait,
       break;
     }
 
+    ++mWaiters;
     mEventsAvailable.Wait();
+    --mWaiters;
   }
 
   return event.forget();
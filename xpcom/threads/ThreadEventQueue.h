@@ -110,6 +110,8 @@ private:
   CondVar mEventsAvailable;
 
   bool mEventsAreDoomed = false;
+  // Number of threads blocked on mEventsAvailable. Protected by mLock.
+  uint32_t mWaiters = 0;
   nsCOMPtr<nsIThreadObserver> mObserver;
 };
 
@@ -28,6 +28,10 @@ using namespace mozilla::tasktracer;
 
 NS_IMPL_ISUPPORTS(TimerThread, nsIRunnable, nsIObserver)
 
+// Low priority timers are allowed to fire up to this late, so that the timer
+// thread can service several of them with a single wakeup.
+static const uint32_t kLowPriorityCoalescingMs = 50;
+
 TimerThread::TimerThread() :
   mInitialized(false),
   mMonitor("TimerThread.mMonitor"),
@@ -35,6 +39,7 @@ TimerThread::TimerThread() :
   mWaiting(false),
   mNotified(false),
   mSleeping(false),
+  mCoalescingEpoch(TimeStamp::Now()),
   mAllowedEarlyFiringMicroseconds(0)
 {
 }
@@ -433,7 +438,7 @@ TimerThread::Run()
       RemoveLeadingCanceledTimersInternal();
 
       if (!mTimers.IsEmpty()) {
-        if (now >= mTimers[0]->Value()->mTimeout || forceRunThisTimer) {
+        if (now >= mTimers[0]->Timeout() || forceRunThisTimer) {
     next:
           // NB: AddRef before the Release under RemoveTimerInternal to avoid
           // mRefCnt passing through zero, in case all other refs than the one
@@ -487,7 +492,7 @@ TimerThread::Run()
       RemoveLeadingCanceledTimersInternal();
 
       if (!mTimers.IsEmpty()) {
-        TimeStamp timeout = mTimers[0]->Value()->mTimeout;
+        TimeStamp timeout = mTimers[0]->Timeout();
 
         // Don't wait at all (even for PR_INTERVAL_NO_WAIT) if the next timer
         // is due now or overdue.
@@ -675,8 +680,18 @@ TimerThread::AddTimerInternal(nsTimerImpl* aTimer)
 
   TimeStamp now = TimeStamp::Now();
 
+  // Round the deadline of low priority timers up to a multiple of the
+  // coalescing window, so that timers due around the same time share a
+  // deadline and are fired together.
+  TimeStamp timeout = aTimer->mTimeout;
+  if (aTimer->IsLowPriority() && timeout > mCoalescingEpoch) {
+    double ms = (timeout - mCoalescingEpoch).ToMilliseconds();
+    double rounded = ceil(ms / kLowPriorityCoalescingMs) * kLowPriorityCoalescingMs;
+    timeout = mCoalescingEpoch + TimeDuration::FromMilliseconds(rounded);
+  }
+
   UniquePtr<Entry>* entry = mTimers.AppendElement(
-    MakeUnique<Entry>(now, aTimer->mTimeout, aTimer), mozilla::fallible);
+    MakeUnique<Entry>(now, timeout, aTimer), mozilla::fallible);
   if (!entry) {
     return false;
   }
@@ -83,6 +83,9 @@ private:
   bool mNotified;
   bool mSleeping;
 
+  // Reference point that low priority timer deadlines are rounded against.
+  const TimeStamp mCoalescingEpoch;
+
   class Entry final : public nsTimerImplHolder
   {
     const TimeStamp mTimeout;
@@ -94,7 +94,12 @@ nsThreadPool::PutEvent(already_AddRefed<nsIRunnable> aEvent, uint32_t aFlags)
     }
 
     mEvents.PutEvent(Move(aEvent), EventPriority::Normal, lock);
-    mEventsAvailable.Notify();
+    // Only idle threads ever wait on mEventsAvailable; busy threads pick the
+    // event up when they finish their current one, so don't bother waking
+    // anybody if there is nobody asleep.
+    if (mIdleCount) {
+      mEventsAvailable.Notify();
+    }
     stackSize = mStackSize;
   }
 